@@ -27,8 +27,18 @@
 % resonance: value in [0, 15]
 % volume: value in [0, 1]
 % y: output
+%
+% If c64_filter_8580_oct has been built (run make in this directory), the C
+% implementation is used instead, with exact tan() and omega functions. In that
+% case bypass, hp, bp, lp, cutoff, resonance, and volume can also be vectors of
+% N settings, and y has then one column per setting.
 function y = c64_filter_8580(x, fs, bypass, hp, bp, lp, cutoff, resonance, volume)
   
+  if (exist("c64_filter_8580_oct") == 3)
+    y = c64_filter_8580_oct(x, fs, bypass, hp, bp, lp, cutoff, resonance, volume);
+    return;
+  endif
+  
   % absolute constants
   
   kin = 5.838280339378168e-1;
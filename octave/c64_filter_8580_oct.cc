@@ -0,0 +1,140 @@
+//
+// c64_filter_8580_oct.cc - MOS 8580 filter simulation, native implementation
+//
+// Copyright (C) Orastron srl unipersonale 2022
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3 of the License.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with A-SID.  If not, see <http://www.gnu.org/licenses/>.
+//
+// File author: Stefano D'Angelo
+//
+// Runs the C ordsp_mos_8580_filter (src/mos_8580_filter.c) behind the
+// c64_filter_8580() interface. Build with "make" in this directory.
+
+#include <octave/oct.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "mos_8580_filter.h"
+
+enum {
+	a_x,
+	a_fs,
+	a_bypass,
+	a_hp,
+	a_bp,
+	a_lp,
+	a_cutoff,
+	a_resonance,
+	a_volume,
+	a_reference,
+	a_n
+};
+
+struct job {
+	std::vector<float>	x;
+	float			fs;
+	const NDArray		*p;
+	octave_idx_type		n_settings;
+	bool			reference;
+	double			*y;
+};
+
+static float param(const job &j, int a, octave_idx_type s) {
+	const NDArray &v = j.p[a];
+	return static_cast<float>(v.numel() == 1 ? v(0) : v(s));
+}
+
+static void run(const job &j, octave_idx_type first, octave_idx_type step, char *ok) {
+	ordsp_mos_8580_filter f = ordsp_mos_8580_filter_new();
+	*ok = f != nullptr;
+	if (f == nullptr)
+		return;
+	const octave_idx_type n = j.x.size();
+	std::vector<float> y(n);
+	ordsp_mos_8580_filter_set_quality(f, j.reference ? ordsp_mos_8580_filter_quality_reference : ordsp_mos_8580_filter_quality_balanced);
+	ordsp_mos_8580_filter_set_sample_rate(f, j.fs);
+	for (octave_idx_type s = first; s < j.n_settings; s += step) {
+		ordsp_mos_8580_filter_set_mode(f, param(j, a_bypass, s), param(j, a_lp, s), param(j, a_bp, s), param(j, a_hp, s));
+		ordsp_mos_8580_filter_set_cutoff(f, (1.f / 2047.f) * param(j, a_cutoff, s));
+		ordsp_mos_8580_filter_set_resonance(f, (1.f / 15.f) * param(j, a_resonance, s));
+		ordsp_mos_8580_filter_set_volume(f, param(j, a_volume, s));
+		ordsp_mos_8580_filter_reset(f);
+		ordsp_mos_8580_filter_process(f, j.x.data(), y.data(), static_cast<int>(n));
+		std::copy(y.begin(), y.end(), j.y + s * n);
+	}
+	ordsp_mos_8580_filter_free(f);
+}
+
+DEFUN_DLD(c64_filter_8580_oct, args, ,
+"-*- texinfo -*-\n\
+@deftypefn {} {@var{y} =} c64_filter_8580_oct (@var{x}, @var{fs}, @var{bypass}, @var{hp}, @var{bp}, @var{lp}, @var{cutoff}, @var{resonance}, @var{volume})\n\
+@deftypefnx {} {@var{y} =} c64_filter_8580_oct (@dots{}, @var{reference})\n\
+Same as c64_filter_8580(), but runs the C implementation.\n\
+\n\
+Each of @var{bypass}, @var{hp}, @var{bp}, @var{lp}, @var{cutoff},\n\
+@var{resonance}, and @var{volume} can either be a scalar or a vector of\n\
+N settings, in which case @var{y} has one column per setting.\n\
+\n\
+If @var{reference} is true (default) the exact tan() and omega (Lambert W)\n\
+functions are used, otherwise the approximations used in the plugin.\n\
+@end deftypefn")
+{
+	const int nargin = args.length();
+	if (nargin < a_reference || nargin > a_n)
+		print_usage();
+
+	if (!args(a_x).isnumeric() || args(a_x).ndims() != 2 || (args(a_x).rows() != 1 && args(a_x).columns() != 1))
+		error("c64_filter_8580_oct: X must be a numeric vector");
+	const NDArray xd = args(a_x).array_value();
+
+	NDArray p[a_n];
+	octave_idx_type n_settings = 1;
+	for (int a = a_bypass; a <= a_volume; a++) {
+		p[a] = args(a).array_value();
+		const octave_idx_type n = p[a].numel();
+		if (n == 1)
+			continue;
+		if (n == 0 || (n_settings != 1 && n != n_settings))
+			error("c64_filter_8580_oct: parameters must be scalars or vectors of the same length");
+		n_settings = n;
+	}
+
+	job j;
+	j.x.resize(xd.numel());
+	for (octave_idx_type i = 0; i < xd.numel(); i++)
+		j.x[i] = static_cast<float>(xd(i));
+	j.fs = static_cast<float>(args(a_fs).double_value());
+	j.p = p;
+	j.n_settings = n_settings;
+	j.reference = nargin > a_reference ? args(a_reference).bool_value() : true;
+
+	Matrix y(xd.numel(), n_settings);
+	j.y = y.fortran_vec();
+
+	const octave_idx_type n_threads = std::max<octave_idx_type>(1, std::min<octave_idx_type>(n_settings, std::thread::hardware_concurrency()));
+	std::vector<std::thread> threads;
+	std::vector<char> ok(n_threads);
+	for (octave_idx_type t = 1; t < n_threads; t++)
+		threads.emplace_back(run, std::cref(j), t, n_threads, ok.data() + t);
+	run(j, 0, n_threads, ok.data());
+	for (auto &t : threads)
+		t.join();
+	if (std::find(ok.begin(), ok.end(), 0) != ok.end())
+		error("c64_filter_8580_oct: out of memory");
+
+	if (n_settings == 1 && xd.rows() == 1)
+		return octave_value(y.transpose());
+	return octave_value(y);
+}
@@ -0,0 +1,69 @@
+%
+% loadsweep.m - loads the output of tools/sweep
+%
+% Copyright (C) Orastron srl unipersonale 2022
+%
+% This program is free software: you can redistribute it and/or modify
+% it under the terms of the GNU General Public License as published by
+% the Free Software Foundation, version 3 of the License.
+%
+% This program is distributed in the hope that it will be useful,
+% but WITHOUT ANY WARRANTY; without even the implied warranty of
+% MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+% GNU General Public License for more details.
+%
+% You should have received a copy of the GNU General Public License
+% along with A-SID.  If not, see <http://www.gnu.org/licenses/>.
+%
+% File author: Stefano D'Angelo
+
+% filename: file written by tools/sweep
+% r: struct array, one element per setting, with fields fs, cutoff,
+%    resonance, ir (column vector, ir_pre samples before t = 0), and spectra
+%    (W / 2 + 1 x K matrix, column k is the k-th harmonic magnitude spectrum)
+% info: struct with fields harmonics, window, ir_pre, amplitude, mode,
+%       quality, and nonlinear
+function [r, info] = loadsweep(filename)
+
+  f = fopen(filename, "rb", "ieee-le");
+  if (f < 0)
+    error("loadsweep: cannot open %s", filename);
+  endif
+  if (!strcmp(char(fread(f, 4, "uchar")'), "ASIR"))
+    fclose(f);
+    error("loadsweep: %s is not a sweep file", filename);
+  endif
+  version = fread(f, 1, "uint32");
+  if (version != 1 && version != 2)
+    fclose(f);
+    error("loadsweep: %s is a version %d sweep file, only 1 and 2 are supported", filename, version);
+  endif
+
+  n = fread(f, 1, "uint32");
+  info.harmonics = fread(f, 1, "uint32");
+  info.window = fread(f, 1, "uint32");
+  info.ir_pre = fread(f, 1, "uint32");
+  info.amplitude = fread(f, 1, "float32");
+  info.mode = fread(f, 1, "uint8");
+  info.quality = fread(f, 1, "uint8");
+  info.nonlinear = fread(f, 1, "uint8");	% padding in version 1
+  if (version == 1)
+    info.nonlinear = 0;
+  endif
+  fread(f, 1, "uint8");
+
+  bins = info.window / 2 + 1;
+  r = struct("fs", cell(n, 1), "cutoff", [], "resonance", [], "ir", [], "spectra", []);
+  for i = 1:n
+    r(i).fs = fread(f, 1, "float32");
+    r(i).cutoff = fread(f, 1, "uint16");
+    r(i).resonance = fread(f, 1, "uint8");
+    fread(f, 1, "uint8");
+    len = fread(f, 1, "uint32");
+    r(i).ir = fread(f, len, "float32");
+    r(i).spectra = fread(f, [bins, info.harmonics], "float32");
+  endfor
+
+  fclose(f);
+
+endfunction
@@ -0,0 +1,54 @@
+%
+% writecalibration.m - writes a cutoff curve calibration file for src/mos_calibration.c
+%
+% Copyright (C) Orastron srl unipersonale 2022
+%
+% This program is free software: you can redistribute it and/or modify
+% it under the terms of the GNU General Public License as published by
+% the Free Software Foundation, version 3 of the License.
+%
+% This program is distributed in the hope that it will be useful,
+% but WITHOUT ANY WARRANTY; without even the implied warranty of
+% MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+% GNU General Public License for more details.
+%
+% You should have received a copy of the GNU General Public License
+% along with A-SID.  If not, see <http://www.gnu.org/licenses/>.
+%
+% File author: Stefano D'Angelo
+
+% filename: file to write
+% reg: measured cutoff register values, in [0, 2047] (e.g., from the
+%      sid-measurements cutoff sweeps)
+% freq: measured cutoff frequencies (Hz), same size as reg
+% model: "8580" or "6581"
+%
+% The curve is interpolated with monotone cubics (pchip) at all register
+% values, held constant outside the measured range, and made nondecreasing.
+function writecalibration(filename, reg, freq, model)
+
+  switch (model)
+    case "8580"
+      m = 0;
+    case "6581"
+      m = 1;
+    otherwise
+      error("writecalibration: unknown model %s", model);
+  endswitch
+
+  [reg, i] = unique(reg(:));
+  freq = freq(:)(i);
+  x = (0:2047)';
+  y = interp1(reg, freq, min(max(x, reg(1)), reg(end)), "pchip");
+  y = cummax(max(y, 0));
+
+  f = fopen(filename, "wb", "ieee-le");
+  if (f < 0)
+    error("writecalibration: cannot open %s", filename);
+  endif
+  fwrite(f, "ASCC", "uchar");
+  fwrite(f, [1; m; 2048], "uint32");
+  fwrite(f, y, "float32");
+  fclose(f);
+
+endfunction
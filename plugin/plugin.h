@@ -20,12 +20,42 @@
 
 #include "asid.h"
 
+#include <string.h>
+
+// Indices as in tibia/product.json
+enum {
+	p_cutoff,
+	p_lfo_amount,
+	p_lfo_speed,
+	p_bypass,
+	p_modulated_cutoff,
+	p_env_amount,
+	p_env_attack,
+	p_env_release,
+	p_n
+};
+
+// To asid parameter indices, -1 if handled here
+static const int asid_params[p_n] = { 0, 1, 2, -1, 3, 4, 5, 6 };
+
+// All engine memory comes from the host through plugin_mem_set(), no
+// allocations and no locks after that. Calibration files are not used, so
+// asid_fini() would have nothing to release and the host can just drop the
+// memory.
+
 typedef struct plugin {
-	asid	instance;
+	asid	engine;		// NULL until plugin_mem_set()
+	float	sample_rate;
+	float	params[p_n];	// host values, applied again to each new engine
+	char	bypass;
 } plugin;
 
 static void plugin_init(plugin *instance) {
-	instance->instance = asid_new();
+	instance->engine = NULL;
+	instance->sample_rate = 44100.f;
+	for (int i = 0; i < p_n; i++)
+		instance->params[i] = 0.f;
+	instance->bypass = 0;
 }
 
 static void plugin_fini(plugin *instance) {
@@ -34,74 +64,48 @@ static void plugin_fini(plugin *instance) {
 
 static void plugin_set_sample_rate(plugin *instance, float sample_rate) {
 	instance->sample_rate = sample_rate;
-	//safe approx instance->delay_line_length = ceilf(sample_rate) + 1;
-	instance->delay_line_length = (size_t)(sample_rate + 1.f) + 1;
 }
 
 static size_t plugin_mem_req(plugin *instance) {
-	return instance->delay_line_length * sizeof(float);
+	(void)instance;
+	return asid_mem_req();
 }
 
 static void plugin_mem_set(plugin *instance, void *mem) {
-	instance->delay_line = (float *)mem;
+	instance->engine = asid_new_in(mem);
+	asid_set_sample_rate(instance->engine, instance->sample_rate);
+	for (int i = 0; i < p_n; i++)
+		if (asid_params[i] >= 0 && i != p_modulated_cutoff)
+			asid_set_parameter(instance->engine, asid_params[i], 0.01f * instance->params[i]);
 }
 
 static void plugin_reset(plugin *instance) {
-	for (size_t i = 0; i < instance->delay_line_length; i++)
-		instance->delay_line[i] = 0.f;
-	instance->delay_line_cur = 0;
-	instance->z1 = 0.f;
-	instance->cutoff_k = 1.f;
-	instance->yz1 = 0.f;
+	asid_reset(instance->engine);
 }
 
+// Percentages, bypass is 0 or 1
 static void plugin_set_parameter(plugin *instance, size_t index, float value) {
-	switch (index) {
-	case 0:
-		//approx instance->gain = powf(10.f, 0.05f * value);
-		instance->gain = ((2.6039890429412597e-4f * value + 0.032131027163547855f) * value + 1.f) / ((0.0012705124328080768f * value - 0.0666763481312185f) * value + 1.f);
-		break;
-	case 1:
-		instance->delay = 0.001f * value;
-		break;
-	case 2:
-		instance->cutoff = value;
-		break;
-	case 3:
+	if (index >= p_n || index == p_modulated_cutoff)
+		return;
+	instance->params[index] = value;
+	if (index == p_bypass)
 		instance->bypass = value >= 0.5f;
-		break;
-	}
+	else if (instance->engine != NULL)
+		asid_set_parameter(instance->engine, asid_params[index], 0.01f * value);
 }
 
 static float plugin_get_parameter(plugin *instance, size_t index) {
-	(void)index;
-	return instance->yz1;
-}
-
-static size_t calc_index(size_t cur, size_t delay, size_t len) {
-	return (cur < delay ? cur + len : cur) - delay;
+	if (index != p_modulated_cutoff || instance->engine == NULL)
+		return 0.f;
+	return 100.f * asid_get_parameter(instance->engine, asid_params[p_modulated_cutoff]);
 }
 
+// inputs[0] == outputs[0] is fine
 static void plugin_process(plugin *instance, const float **inputs, float **outputs, size_t n_samples) {
-	//approx size_t delay = roundf(instance->sample_rate * instance->delay);
-	size_t delay = (size_t)(instance->sample_rate * instance->delay + 0.5f);
-	const float mA1 = instance->sample_rate / (instance->sample_rate + 6.283185307179586f * instance->cutoff * instance->cutoff_k);
-	for (size_t i = 0; i < n_samples; i++) {
-		instance->delay_line[instance->delay_line_cur] = inputs[0][i];
-		const float x = instance->delay_line[calc_index(instance->delay_line_cur, delay, instance->delay_line_length)];
-		instance->delay_line_cur++;
-		if (instance->delay_line_cur == instance->delay_line_length)
-			instance->delay_line_cur = 0;
-		const float y = x + mA1 * (instance->z1 - x);
-		instance->z1 = y;
-		outputs[0][i] = instance->bypass ? inputs[0][i] : instance->gain * y;
-		instance->yz1 = outputs[0][i];
+	if (instance->bypass) {
+		if (outputs[0] != inputs[0])
+			memcpy(outputs[0], inputs[0], n_samples * sizeof(float));
+		return;
 	}
-}
-
-static void plugin_midi_msg_in(plugin *instance, size_t index, const uint8_t * data) {
-	(void)index;
-	if (((data[0] & 0xf0) == 0x90) && (data[2] != 0))
-		//approx instance->cutoff_k = powf(2.f, (1.f / 12.f) * (note - 60));
-		instance->cutoff_k = data[1] < 64 ? (-0.19558034980097166f * data[1] - 2.361735109225749f) / (data[1] - 75.57552349522389f) : (393.95397927344214f - 7.660826245588588f * data[1]) / (data[1] - 139.0755234952239f);
+	asid_process(instance->engine, inputs, outputs, (int)n_samples);
 }
@@ -0,0 +1,896 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Python bindings for the A-SID engine and the MOS 8580 filter.
+//
+// Audio buffers are accepted through the buffer protocol (e.g., NumPy float32
+// C-contiguous arrays) and are never copied. The GIL is released while
+// processing. The *_batch() functions process a [batch, samples] array with
+// one independent engine per row, spread across threads.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <pthread.h>
+#endif
+
+#include "asid.h"
+#include "mos_8580_filter.h"
+
+#define MAX_THREADS	64
+
+// Buffers
+
+typedef struct {
+	Py_buffer	x;
+	Py_buffer	y;
+	PyObject	*out;
+	Py_ssize_t	 rows;
+	Py_ssize_t	 cols;
+} buffers;
+
+static PyObject *new_output_like(PyObject *x) {
+	PyObject *np = PyImport_ImportModule("numpy");
+	if (np == NULL)
+		return NULL;
+	PyObject *r = PyObject_CallMethod(np, "empty_like", "Os", x, "float32");
+	Py_DECREF(np);
+	return r;
+}
+
+static int check_float_buffer(Py_buffer *b, const char *name) {
+	if (b->itemsize != sizeof(float) || b->format == NULL || strcmp(b->format, "f")) {
+		PyErr_Format(PyExc_TypeError, "%s must be a float32 buffer", name);
+		return -1;
+	}
+	if (b->ndim < 1 || b->ndim > 2) {
+		PyErr_Format(PyExc_ValueError, "%s must be 1-D or 2-D", name);
+		return -1;
+	}
+	return 0;
+}
+
+static void buffers_release(buffers *b) {
+	PyBuffer_Release(&b->y);
+	PyBuffer_Release(&b->x);
+}
+
+// On success returns a new reference to the output object in b->out.
+static int buffers_get(buffers *b, PyObject *x, PyObject *out, int max_ndim) {
+	if (PyObject_GetBuffer(x, &b->x, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+		return -1;
+	if (check_float_buffer(&b->x, "x") < 0 || b->x.ndim > max_ndim) {
+		if (!PyErr_Occurred())
+			PyErr_Format(PyExc_ValueError, "x must be %d-D", max_ndim);
+		PyBuffer_Release(&b->x);
+		return -1;
+	}
+
+	if (out == NULL || out == Py_None) {
+		out = new_output_like(x);
+		if (out == NULL) {
+			PyBuffer_Release(&b->x);
+			return -1;
+		}
+	}
+	else
+		Py_INCREF(out);
+
+	if (PyObject_GetBuffer(out, &b->y, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE) < 0)
+		goto err;
+	if (check_float_buffer(&b->y, "out") < 0) {
+		PyBuffer_Release(&b->y);
+		goto err;
+	}
+	if (b->y.ndim != b->x.ndim || memcmp(b->y.shape, b->x.shape, b->x.ndim * sizeof(Py_ssize_t))) {
+		PyErr_SetString(PyExc_ValueError, "out must have the same shape as x");
+		PyBuffer_Release(&b->y);
+		goto err;
+	}
+
+	b->out = out;
+	b->rows = b->x.ndim == 2 ? b->x.shape[0] : 1;
+	b->cols = b->x.shape[b->x.ndim - 1];
+	if (b->cols > INT_MAX) {
+		PyErr_SetString(PyExc_OverflowError, "too many samples");
+		buffers_release(b);
+		Py_DECREF(out);
+		return -1;
+	}
+	return 0;
+
+err:
+	PyBuffer_Release(&b->x);
+	Py_DECREF(out);
+	return -1;
+}
+
+// Per-row parameters: either a scalar or a sequence of length rows
+
+static float *get_row_values(PyObject *o, Py_ssize_t rows, float def, const char *name) {
+	float *r = (float *)PyMem_Malloc(rows * sizeof(float));
+	if (r == NULL) {
+		PyErr_NoMemory();
+		return NULL;
+	}
+	if (o == NULL || o == Py_None) {
+		for (Py_ssize_t i = 0; i < rows; i++)
+			r[i] = def;
+		return r;
+	}
+	if (PyNumber_Check(o) && !PySequence_Check(o)) {
+		const double v = PyFloat_AsDouble(o);
+		if (v == -1.0 && PyErr_Occurred())
+			goto err;
+		for (Py_ssize_t i = 0; i < rows; i++)
+			r[i] = (float)v;
+		return r;
+	}
+	PyObject *s = PySequence_Fast(o, name);
+	if (s == NULL)
+		goto err;
+	if (PySequence_Fast_GET_SIZE(s) != rows) {
+		PyErr_Format(PyExc_ValueError, "%s must be a scalar or have one value per row", name);
+		Py_DECREF(s);
+		goto err;
+	}
+	for (Py_ssize_t i = 0; i < rows; i++) {
+		const double v = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(s, i));
+		if (v == -1.0 && PyErr_Occurred()) {
+			Py_DECREF(s);
+			goto err;
+		}
+		r[i] = (float)v;
+	}
+	Py_DECREF(s);
+	return r;
+
+err:
+	PyMem_Free(r);
+	return NULL;
+}
+
+// Threads
+
+typedef struct {
+	void		 (*fn)(void *job, int index);
+	void		*job;
+	int		 index;
+} worker;
+
+#ifdef _WIN32
+static DWORD WINAPI worker_run(LPVOID arg) {
+	worker *w = (worker *)arg;
+	w->fn(w->job, w->index);
+	return 0;
+}
+#else
+static void *worker_run(void *arg) {
+	worker *w = (worker *)arg;
+	w->fn(w->job, w->index);
+	return NULL;
+}
+#endif
+
+// Runs fn(job, 0..n_threads-1), the last one on the calling thread.
+static void run_workers(void (*fn)(void *job, int index), void *job, int n_threads) {
+	worker w[MAX_THREADS];
+#ifdef _WIN32
+	HANDLE t[MAX_THREADS];
+#else
+	pthread_t t[MAX_THREADS];
+#endif
+	char started[MAX_THREADS];
+	for (int i = 0; i < n_threads - 1; i++) {
+		w[i].fn = fn;
+		w[i].job = job;
+		w[i].index = i;
+#ifdef _WIN32
+		t[i] = CreateThread(NULL, 0, worker_run, w + i, 0, NULL);
+		started[i] = t[i] != NULL;
+#else
+		started[i] = pthread_create(t + i, NULL, worker_run, w + i) == 0;
+#endif
+		if (!started[i])
+			fn(job, i);
+	}
+	fn(job, n_threads - 1);
+	for (int i = 0; i < n_threads - 1; i++) {
+		if (!started[i])
+			continue;
+#ifdef _WIN32
+		WaitForSingleObject(t[i], INFINITE);
+		CloseHandle(t[i]);
+#else
+		pthread_join(t[i], NULL);
+#endif
+	}
+}
+
+static int get_n_threads(int n_threads, Py_ssize_t rows) {
+	if (n_threads <= 0) {
+#ifdef _WIN32
+		SYSTEM_INFO si;
+		GetSystemInfo(&si);
+		n_threads = (int)si.dwNumberOfProcessors;
+#else
+		n_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	}
+	if (n_threads > MAX_THREADS)
+		n_threads = MAX_THREADS;
+	if (n_threads > rows)
+		n_threads = (int)rows;
+	return n_threads < 1 ? 1 : n_threads;
+}
+
+// Asid type
+
+typedef struct {
+	PyObject_HEAD
+	asid	 instance;
+	float	 sample_rate;
+	char	 busy;
+} AsidObject;
+
+static int Asid_init(AsidObject *self, PyObject *args, PyObject *kwds) {
+	static char *kwlist[] = { "sample_rate", NULL };
+	float sample_rate = 44100.f;
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|f", kwlist, &sample_rate))
+		return -1;
+	if (self->instance == NULL) {
+		self->instance = asid_new();
+		if (self->instance == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+	}
+	self->sample_rate = sample_rate;
+	asid_set_sample_rate(self->instance, sample_rate);
+	asid_reset(self->instance);
+	return 0;
+}
+
+static void Asid_dealloc(AsidObject *self) {
+	if (self->instance)
+		asid_free(self->instance);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int Asid_check(AsidObject *self) {
+	if (self->instance == NULL) {
+		PyErr_SetString(PyExc_RuntimeError, "object not initialized");
+		return -1;
+	}
+	if (self->busy) {
+		PyErr_SetString(PyExc_RuntimeError, "object is being used by another thread");
+		return -1;
+	}
+	return 0;
+}
+
+static PyObject *Asid_set_sample_rate(AsidObject *self, PyObject *arg) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	const double v = PyFloat_AsDouble(arg);
+	if (v == -1.0 && PyErr_Occurred())
+		return NULL;
+	self->sample_rate = (float)v;
+	asid_set_sample_rate(self->instance, self->sample_rate);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_reset(AsidObject *self, PyObject *Py_UNUSED(ignored)) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	asid_reset(self->instance);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_set_parameter(AsidObject *self, PyObject *args) {
+	int index;
+	float value;
+	if (!PyArg_ParseTuple(args, "if", &index, &value))
+		return NULL;
+	if (Asid_check(self) < 0)
+		return NULL;
+	if (index < 0 || index > 6 || index == 3) {
+		PyErr_SetString(PyExc_IndexError, "parameter index out of range");
+		return NULL;
+	}
+	asid_set_parameter(self->instance, index, value);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_get_parameter(AsidObject *self, PyObject *args) {
+	int index;
+	if (!PyArg_ParseTuple(args, "i", &index))
+		return NULL;
+	if (Asid_check(self) < 0)
+		return NULL;
+	if (index < 0 || index > 6) {
+		PyErr_SetString(PyExc_IndexError, "parameter index out of range");
+		return NULL;
+	}
+	return PyFloat_FromDouble(asid_get_parameter(self->instance, index));
+}
+
+static PyObject *Asid_set_quality(AsidObject *self, PyObject *arg) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	const long v = PyLong_AsLong(arg);
+	if (v == -1 && PyErr_Occurred())
+		return NULL;
+	if (v < asid_quality_fast || v > asid_quality_reference) {
+		PyErr_SetString(PyExc_ValueError, "invalid quality");
+		return NULL;
+	}
+	asid_set_quality(self->instance, (asid_quality)v);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_set_model(AsidObject *self, PyObject *arg) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	const long v = PyLong_AsLong(arg);
+	if (v == -1 && PyErr_Occurred())
+		return NULL;
+	if (v < 0 || v >= asid_model_n) {
+		PyErr_SetString(PyExc_ValueError, "invalid model");
+		return NULL;
+	}
+	asid_set_model(self->instance, (asid_model)v);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_set_stages(AsidObject *self, PyObject *arg) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	const long v = PyLong_AsLong(arg);
+	if (v == -1 && PyErr_Occurred())
+		return NULL;
+	if (v < 1 || v > ASID_STAGES_MAX) {
+		PyErr_SetString(PyExc_ValueError, "number of stages out of range");
+		return NULL;
+	}
+	asid_set_stages(self->instance, (int)v);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_set_decimation(AsidObject *self, PyObject *arg) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	const int v = PyObject_IsTrue(arg);
+	if (v < 0)
+		return NULL;
+	asid_set_decimation(self->instance, (char)v);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_get_latency(AsidObject *self, PyObject *Py_UNUSED(ignored)) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	return PyLong_FromLong(asid_get_latency(self->instance));
+}
+
+static PyObject *Asid_set_calibration(AsidObject *self, PyObject *arg) {
+	if (Asid_check(self) < 0)
+		return NULL;
+	const char *path = NULL;
+	PyObject *bytes = NULL;
+	if (arg != Py_None) {
+		if (!PyUnicode_FSConverter(arg, &bytes))
+			return NULL;
+		path = PyBytes_AsString(bytes);
+	}
+	const char ok = asid_set_calibration(self->instance, path);
+	Py_XDECREF(bytes);
+	if (!ok) {
+		PyErr_SetString(PyExc_ValueError, "cannot load calibration file");
+		return NULL;
+	}
+	Py_RETURN_NONE;
+}
+
+static int Asid_check_stage(int stage) {
+	if (stage < 0 || stage >= ASID_STAGES_MAX) {
+		PyErr_SetString(PyExc_IndexError, "stage index out of range");
+		return -1;
+	}
+	return 0;
+}
+
+static PyObject *Asid_set_stage_cutoff_offset(AsidObject *self, PyObject *args) {
+	int stage;
+	float value;
+	if (!PyArg_ParseTuple(args, "if", &stage, &value))
+		return NULL;
+	if (Asid_check(self) < 0 || Asid_check_stage(stage) < 0)
+		return NULL;
+	asid_set_stage_cutoff_offset(self->instance, stage, value);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_set_stage_lfo_offset(AsidObject *self, PyObject *args) {
+	int stage;
+	float value;
+	if (!PyArg_ParseTuple(args, "if", &stage, &value))
+		return NULL;
+	if (Asid_check(self) < 0 || Asid_check_stage(stage) < 0)
+		return NULL;
+	asid_set_stage_lfo_offset(self->instance, stage, value);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_set_stage_mode(AsidObject *self, PyObject *args) {
+	int stage;
+	float lp, bp, hp;
+	if (!PyArg_ParseTuple(args, "ifff", &stage, &lp, &bp, &hp))
+		return NULL;
+	if (Asid_check(self) < 0 || Asid_check_stage(stage) < 0)
+		return NULL;
+	asid_set_stage_mode(self->instance, stage, lp, bp, hp);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_set_stage_volume(AsidObject *self, PyObject *args) {
+	int stage;
+	float value;
+	if (!PyArg_ParseTuple(args, "if", &stage, &value))
+		return NULL;
+	if (Asid_check(self) < 0 || Asid_check_stage(stage) < 0)
+		return NULL;
+	asid_set_stage_volume(self->instance, stage, value);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Asid_process(AsidObject *self, PyObject *args, PyObject *kwds) {
+	static char *kwlist[] = { "x", "out", NULL };
+	PyObject *x, *out = NULL;
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O", kwlist, &x, &out))
+		return NULL;
+	if (Asid_check(self) < 0)
+		return NULL;
+
+	buffers b;
+	if (buffers_get(&b, x, out, 1) < 0)
+		return NULL;
+
+	const float *xp = (const float *)b.x.buf;
+	float *yp = (float *)b.y.buf;
+	self->busy = 1;
+	Py_BEGIN_ALLOW_THREADS
+	asid_process(self->instance, &xp, &yp, (int)b.cols);
+	Py_END_ALLOW_THREADS
+	self->busy = 0;
+
+	buffers_release(&b);
+	return b.out;
+}
+
+static PyMethodDef Asid_methods[] = {
+	{ "set_sample_rate", (PyCFunction)Asid_set_sample_rate, METH_O, "set_sample_rate(sample_rate)" },
+	{ "reset", (PyCFunction)Asid_reset, METH_NOARGS, "reset()" },
+	{ "set_parameter", (PyCFunction)Asid_set_parameter, METH_VARARGS, "set_parameter(index, value): 0 = cutoff, 1 = LFO amount, 2 = LFO speed, 4 = envelope amount, 5 = envelope attack, 6 = envelope release, values in [0, 1]" },
+	{ "get_parameter", (PyCFunction)Asid_get_parameter, METH_VARARGS, "get_parameter(index): as set_parameter(), plus 3 = modulated cutoff" },
+	{ "set_quality", (PyCFunction)Asid_set_quality, METH_O, "set_quality(value): QUALITY_FAST, QUALITY_BALANCED (default), or QUALITY_REFERENCE" },
+	{ "set_model", (PyCFunction)Asid_set_model, METH_O, "set_model(value): MODEL_8580 (default) or MODEL_6581, resets the filter state" },
+	{ "set_stages", (PyCFunction)Asid_set_stages, METH_O, "set_stages(value): number of cascaded filters in [1, STAGES_MAX], 1 by default" },
+	{ "set_stage_cutoff_offset", (PyCFunction)Asid_set_stage_cutoff_offset, METH_VARARGS, "set_stage_cutoff_offset(stage, value): value in [-1, 1], relative to the cutoff parameter range" },
+	{ "set_stage_lfo_offset", (PyCFunction)Asid_set_stage_lfo_offset, METH_VARARGS, "set_stage_lfo_offset(stage, value): value in [0, 1), fraction of LFO cycle" },
+	{ "set_stage_mode", (PyCFunction)Asid_set_stage_mode, METH_VARARGS, "set_stage_mode(stage, lp, bp, hp), bandpass by default" },
+	{ "set_stage_volume", (PyCFunction)Asid_set_stage_volume, METH_VARARGS, "set_stage_volume(stage, value): value in [0, 1], corresponds to original range [0, 15]" },
+	{ "set_decimation", (PyCFunction)Asid_set_decimation, METH_O, "set_decimation(value): runs at 1/2 or 1/4 of sample rates >= 88.2 kHz, off by default, resets the state" },
+	{ "get_latency", (PyCFunction)Asid_get_latency, METH_NOARGS, "get_latency() -> samples added by decimation" },
+	{ "set_calibration", (PyCFunction)Asid_set_calibration, METH_O, "set_calibration(path): per-chip cutoff curve from a calibration file, None for the built-in curves" },
+	{ "process", (PyCFunction)(void(*)(void))Asid_process, METH_VARARGS | METH_KEYWORDS, "process(x, out=None) -> out: processes a 1-D float32 block, out may be x" },
+	{ NULL }
+};
+
+static PyTypeObject AsidType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	.tp_name = "asid.Asid",
+	.tp_doc = "Asid(sample_rate=44100.): A-SID engine",
+	.tp_basicsize = sizeof(AsidObject),
+	.tp_flags = Py_TPFLAGS_DEFAULT,
+	.tp_new = PyType_GenericNew,
+	.tp_init = (initproc)Asid_init,
+	.tp_dealloc = (destructor)Asid_dealloc,
+	.tp_methods = Asid_methods
+};
+
+// Filter type
+
+typedef struct {
+	PyObject_HEAD
+	ordsp_mos_8580_filter	 instance;
+	char			 busy;
+} FilterObject;
+
+static int Filter_init(FilterObject *self, PyObject *args, PyObject *kwds) {
+	static char *kwlist[] = { "sample_rate", NULL };
+	float sample_rate = 44100.f;
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|f", kwlist, &sample_rate))
+		return -1;
+	if (self->instance == NULL) {
+		self->instance = ordsp_mos_8580_filter_new();
+		if (self->instance == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		ordsp_mos_8580_filter_set_resonance(self->instance, 0.f);
+		ordsp_mos_8580_filter_set_volume(self->instance, 1.f);
+		ordsp_mos_8580_filter_set_mode(self->instance, 0.f, 1.f, 0.f, 0.f);
+	}
+	ordsp_mos_8580_filter_set_sample_rate(self->instance, sample_rate);
+	ordsp_mos_8580_filter_reset(self->instance);
+	return 0;
+}
+
+static void Filter_dealloc(FilterObject *self) {
+	if (self->instance)
+		ordsp_mos_8580_filter_free(self->instance);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int Filter_check(FilterObject *self) {
+	if (self->instance == NULL) {
+		PyErr_SetString(PyExc_RuntimeError, "object not initialized");
+		return -1;
+	}
+	if (self->busy) {
+		PyErr_SetString(PyExc_RuntimeError, "object is being used by another thread");
+		return -1;
+	}
+	return 0;
+}
+
+static PyObject *Filter_set_sample_rate(FilterObject *self, PyObject *arg) {
+	if (Filter_check(self) < 0)
+		return NULL;
+	const double v = PyFloat_AsDouble(arg);
+	if (v == -1.0 && PyErr_Occurred())
+		return NULL;
+	ordsp_mos_8580_filter_set_sample_rate(self->instance, (float)v);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Filter_reset(FilterObject *self, PyObject *Py_UNUSED(ignored)) {
+	if (Filter_check(self) < 0)
+		return NULL;
+	ordsp_mos_8580_filter_reset(self->instance);
+	Py_RETURN_NONE;
+}
+
+#define FILTER_SETTER(name) \
+	static PyObject *Filter_set_##name(FilterObject *self, PyObject *arg) { \
+		if (Filter_check(self) < 0) \
+			return NULL; \
+		const double v = PyFloat_AsDouble(arg); \
+		if (v == -1.0 && PyErr_Occurred()) \
+			return NULL; \
+		ordsp_mos_8580_filter_set_##name(self->instance, (float)v); \
+		Py_RETURN_NONE; \
+	}
+
+FILTER_SETTER(cutoff)
+FILTER_SETTER(resonance)
+FILTER_SETTER(volume)
+
+static PyObject *Filter_set_mode(FilterObject *self, PyObject *args) {
+	float bypass, lp, bp, hp;
+	if (!PyArg_ParseTuple(args, "ffff", &bypass, &lp, &bp, &hp))
+		return NULL;
+	if (Filter_check(self) < 0)
+		return NULL;
+	ordsp_mos_8580_filter_set_mode(self->instance, bypass, lp, bp, hp);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Filter_set_quality(FilterObject *self, PyObject *arg) {
+	if (Filter_check(self) < 0)
+		return NULL;
+	const long v = PyLong_AsLong(arg);
+	if (v == -1 && PyErr_Occurred())
+		return NULL;
+	if (v < ordsp_mos_8580_filter_quality_fast || v > ordsp_mos_8580_filter_quality_reference) {
+		PyErr_SetString(PyExc_ValueError, "invalid quality");
+		return NULL;
+	}
+	ordsp_mos_8580_filter_set_quality(self->instance, (ordsp_mos_8580_filter_quality)v);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Filter_set_nonlinear(FilterObject *self, PyObject *arg) {
+	if (Filter_check(self) < 0)
+		return NULL;
+	const int v = PyObject_IsTrue(arg);
+	if (v < 0)
+		return NULL;
+	ordsp_mos_8580_filter_set_nonlinear(self->instance, (char)v);
+	Py_RETURN_NONE;
+}
+
+static PyObject *Filter_process(FilterObject *self, PyObject *args, PyObject *kwds) {
+	static char *kwlist[] = { "x", "out", NULL };
+	PyObject *x, *out = NULL;
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O", kwlist, &x, &out))
+		return NULL;
+	if (Filter_check(self) < 0)
+		return NULL;
+
+	buffers b;
+	if (buffers_get(&b, x, out, 1) < 0)
+		return NULL;
+
+	self->busy = 1;
+	Py_BEGIN_ALLOW_THREADS
+	ordsp_mos_8580_filter_process(self->instance, (const float *)b.x.buf, (float *)b.y.buf, (int)b.cols);
+	Py_END_ALLOW_THREADS
+	self->busy = 0;
+
+	buffers_release(&b);
+	return b.out;
+}
+
+static PyMethodDef Filter_methods[] = {
+	{ "set_sample_rate", (PyCFunction)Filter_set_sample_rate, METH_O, "set_sample_rate(sample_rate)" },
+	{ "reset", (PyCFunction)Filter_reset, METH_NOARGS, "reset()" },
+	{ "set_cutoff", (PyCFunction)Filter_set_cutoff, METH_O, "set_cutoff(value): value in [0, 1], corresponds to original range [0, 2047]" },
+	{ "set_resonance", (PyCFunction)Filter_set_resonance, METH_O, "set_resonance(value): value in [0, 1], corresponds to original range [0, 15]" },
+	{ "set_volume", (PyCFunction)Filter_set_volume, METH_O, "set_volume(value): value in [0, 1], corresponds to original range [0, 15]" },
+	{ "set_mode", (PyCFunction)Filter_set_mode, METH_VARARGS, "set_mode(bypass, lp, bp, hp)" },
+	{ "set_quality", (PyCFunction)Filter_set_quality, METH_O, "set_quality(value): QUALITY_FAST, QUALITY_BALANCED (default), or QUALITY_REFERENCE" },
+	{ "set_nonlinear", (PyCFunction)Filter_set_nonlinear, METH_O, "set_nonlinear(value): saturating integrators, off by default" },
+	{ "process", (PyCFunction)(void(*)(void))Filter_process, METH_VARARGS | METH_KEYWORDS, "process(x, out=None) -> out: processes a 1-D float32 block, out may be x" },
+	{ NULL }
+};
+
+static PyTypeObject FilterType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	.tp_name = "asid.Filter",
+	.tp_doc = "Filter(sample_rate=44100.): MOS 8580 filter, output gain stage, and output buffer",
+	.tp_basicsize = sizeof(FilterObject),
+	.tp_flags = Py_TPFLAGS_DEFAULT,
+	.tp_new = PyType_GenericNew,
+	.tp_init = (initproc)Filter_init,
+	.tp_dealloc = (destructor)Filter_dealloc,
+	.tp_methods = Filter_methods
+};
+
+// Batch processing
+
+typedef struct {
+	const float	*x;
+	float		*y;
+	Py_ssize_t	 rows;
+	int		 cols;
+	int		 n_threads;
+	float		 sample_rate;
+	float		*p[6];
+	float		 mode[4];
+	int		 model;
+	int		 quality;
+	int		 stages;
+	int		 failed;
+} batch_job;
+
+// asid_batch() parameters: names, engine parameter indices and defaults (as in
+// the engine and vst3/src/vst3/config.h)
+#define ASID_BATCH_PARAMS	6
+static const char *asid_batch_names[ASID_BATCH_PARAMS] = { "cutoff", "lfo_amount", "lfo_speed", "env_amount", "env_attack", "env_release" };
+static const int asid_batch_index[ASID_BATCH_PARAMS] = { 0, 1, 2, 4, 5, 6 };
+static const float asid_batch_defaults[ASID_BATCH_PARAMS] = { 1.f, 0.f, 0.5f, 0.f, 0.3f, 0.5f };
+
+static void asid_batch_run(void *j, int index) {
+	batch_job *job = (batch_job *)j;
+	asid a = asid_new();
+	if (a == NULL) {
+		job->failed = 1;
+		return;
+	}
+	asid_set_sample_rate(a, job->sample_rate);
+	asid_set_model(a, (asid_model)job->model);
+	asid_set_quality(a, (asid_quality)job->quality);
+	asid_set_stages(a, job->stages);
+	for (Py_ssize_t r = index; r < job->rows; r += job->n_threads) {
+		const float *x = job->x + r * job->cols;
+		float *y = job->y + r * job->cols;
+		for (int i = 0; i < ASID_BATCH_PARAMS; i++)
+			asid_set_parameter(a, asid_batch_index[i], job->p[i][r]);
+		asid_reset(a);
+		asid_process(a, &x, &y, job->cols);
+	}
+	asid_free(a);
+}
+
+static void filter_batch_run(void *j, int index) {
+	batch_job *job = (batch_job *)j;
+	ordsp_mos_8580_filter f = ordsp_mos_8580_filter_new();
+	if (f == NULL) {
+		job->failed = 1;
+		return;
+	}
+	ordsp_mos_8580_filter_set_sample_rate(f, job->sample_rate);
+	ordsp_mos_8580_filter_set_mode(f, job->mode[0], job->mode[1], job->mode[2], job->mode[3]);
+	for (Py_ssize_t r = index; r < job->rows; r += job->n_threads) {
+		ordsp_mos_8580_filter_set_cutoff(f, job->p[0][r]);
+		ordsp_mos_8580_filter_set_resonance(f, job->p[1][r]);
+		ordsp_mos_8580_filter_set_volume(f, job->p[2][r]);
+		ordsp_mos_8580_filter_reset(f);
+		ordsp_mos_8580_filter_process(f, job->x + r * job->cols, job->y + r * job->cols, job->cols);
+	}
+	ordsp_mos_8580_filter_free(f);
+}
+
+static PyObject *run_batch(batch_job *job, buffers *b, int n_threads, void (*fn)(void *, int)) {
+	job->x = (const float *)b->x.buf;
+	job->y = (float *)b->y.buf;
+	job->rows = b->rows;
+	job->cols = (int)b->cols;
+	job->n_threads = get_n_threads(n_threads, b->rows);
+	job->failed = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+	run_workers(fn, job, job->n_threads);
+	Py_END_ALLOW_THREADS
+
+	buffers_release(b);
+	if (job->failed) {
+		Py_DECREF(b->out);
+		return PyErr_NoMemory();
+	}
+	return b->out;
+}
+
+static PyObject *asid_batch(PyObject *self, PyObject *args, PyObject *kwds) {
+	static char *kwlist[] = { "x", "sample_rate", "cutoff", "lfo_amount", "lfo_speed", "env_amount", "env_attack", "env_release", "model", "quality", "stages", "out", "threads", NULL };
+	PyObject *x, *p[ASID_BATCH_PARAMS] = { NULL }, *out = NULL;
+	float sample_rate;
+	int model = asid_model_8580, quality = asid_quality_balanced, stages = 1, n_threads = 0;
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "Of|OOOOOOiiiOi", kwlist, &x, &sample_rate, p, p + 1, p + 2, p + 3, p + 4, p + 5, &model, &quality, &stages, &out, &n_threads))
+		return NULL;
+	if (model < 0 || model >= asid_model_n) {
+		PyErr_SetString(PyExc_ValueError, "invalid model");
+		return NULL;
+	}
+	if (quality < asid_quality_fast || quality > asid_quality_reference) {
+		PyErr_SetString(PyExc_ValueError, "invalid quality");
+		return NULL;
+	}
+	if (stages < 1 || stages > ASID_STAGES_MAX) {
+		PyErr_SetString(PyExc_ValueError, "number of stages out of range");
+		return NULL;
+	}
+
+	buffers b;
+	if (buffers_get(&b, x, out, 2) < 0)
+		return NULL;
+
+	batch_job job;
+	job.sample_rate = sample_rate;
+	job.model = model;
+	job.quality = quality;
+	job.stages = stages;
+	int ok = 1;
+	for (int i = 0; i < ASID_BATCH_PARAMS; i++) {
+		job.p[i] = ok ? get_row_values(p[i], b.rows, asid_batch_defaults[i], asid_batch_names[i]) : NULL;
+		ok = job.p[i] != NULL;
+	}
+
+	PyObject *r = NULL;
+	if (ok)
+		r = run_batch(&job, &b, n_threads, asid_batch_run);
+	else {
+		buffers_release(&b);
+		Py_DECREF(b.out);
+	}
+
+	for (int i = 0; i < ASID_BATCH_PARAMS; i++)
+		PyMem_Free(job.p[i]);
+	return r;
+}
+
+static PyObject *filter_batch(PyObject *self, PyObject *args, PyObject *kwds) {
+	static char *kwlist[] = { "x", "sample_rate", "cutoff", "resonance", "volume", "mode", "out", "threads", NULL };
+	PyObject *x, *cutoff = NULL, *resonance = NULL, *volume = NULL, *out = NULL;
+	float sample_rate;
+	float mode[4] = { 0.f, 1.f, 0.f, 0.f };
+	int n_threads = 0;
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "Of|OOO(ffff)Oi", kwlist, &x, &sample_rate, &cutoff, &resonance, &volume, mode, mode + 1, mode + 2, mode + 3, &out, &n_threads))
+		return NULL;
+
+	buffers b;
+	if (buffers_get(&b, x, out, 2) < 0)
+		return NULL;
+
+	batch_job job;
+	job.sample_rate = sample_rate;
+	memcpy(job.mode, mode, sizeof(mode));
+	job.p[0] = get_row_values(cutoff, b.rows, 1.f, "cutoff");
+	job.p[1] = job.p[0] ? get_row_values(resonance, b.rows, 0.f, "resonance") : NULL;
+	job.p[2] = job.p[1] ? get_row_values(volume, b.rows, 1.f, "volume") : NULL;
+
+	PyObject *r = NULL;
+	if (job.p[2])
+		r = run_batch(&job, &b, n_threads, filter_batch_run);
+	else {
+		buffers_release(&b);
+		Py_DECREF(b.out);
+	}
+
+	for (int i = 0; i < 3; i++)
+		PyMem_Free(job.p[i]);
+	return r;
+}
+
+static PyMethodDef module_methods[] = {
+	{ "asid_batch", (PyCFunction)(void(*)(void))asid_batch, METH_VARARGS | METH_KEYWORDS,
+	  "asid_batch(x, sample_rate, cutoff=1., lfo_amount=0., lfo_speed=.5, env_amount=0., env_attack=.3, env_release=.5, model=MODEL_8580, quality=QUALITY_BALANCED, stages=1, out=None, threads=0) -> out\n\n"
+	  "Processes each row of a [batch, samples] float32 array with a freshly reset engine. Parameters are scalars or have one value per row, model, quality and stages are the same for all rows. threads=0 uses all CPUs." },
+	{ "filter_batch", (PyCFunction)(void(*)(void))filter_batch, METH_VARARGS | METH_KEYWORDS,
+	  "filter_batch(x, sample_rate, cutoff=1., resonance=0., volume=1., mode=(0., 1., 0., 0.), out=None, threads=0) -> out\n\n"
+	  "As asid_batch(), but for the bare filter. mode is (bypass, lp, bp, hp)." },
+	{ NULL }
+};
+
+static struct PyModuleDef module = {
+	PyModuleDef_HEAD_INIT,
+	.m_name = "asid",
+	.m_doc = "A-SID engine and MOS 8580 filter",
+	.m_size = -1,
+	.m_methods = module_methods
+};
+
+PyMODINIT_FUNC PyInit_asid(void) {
+	if (PyType_Ready(&AsidType) < 0 || PyType_Ready(&FilterType) < 0)
+		return NULL;
+
+	PyObject *m = PyModule_Create(&module);
+	if (m == NULL)
+		return NULL;
+
+	Py_INCREF(&AsidType);
+	if (PyModule_AddObject(m, "Asid", (PyObject *)&AsidType) < 0) {
+		Py_DECREF(&AsidType);
+		Py_DECREF(m);
+		return NULL;
+	}
+	Py_INCREF(&FilterType);
+	if (PyModule_AddObject(m, "Filter", (PyObject *)&FilterType) < 0) {
+		Py_DECREF(&FilterType);
+		Py_DECREF(m);
+		return NULL;
+	}
+
+	if (PyModule_AddIntConstant(m, "QUALITY_FAST", asid_quality_fast) < 0
+	    || PyModule_AddIntConstant(m, "QUALITY_BALANCED", asid_quality_balanced) < 0
+	    || PyModule_AddIntConstant(m, "QUALITY_REFERENCE", asid_quality_reference) < 0
+	    || PyModule_AddIntConstant(m, "MODEL_8580", asid_model_8580) < 0
+	    || PyModule_AddIntConstant(m, "MODEL_6581", asid_model_6581) < 0
+	    || PyModule_AddIntConstant(m, "STAGES_MAX", ASID_STAGES_MAX) < 0) {
+		Py_DECREF(m);
+		return NULL;
+	}
+
+	return m;
+}
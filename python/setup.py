@@ -0,0 +1,46 @@
+#
+# A-SID - C64 bandpass filter + LFO
+#
+# Copyright (C) 2022 Orastron srl unipersonale
+#
+# A-SID is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3 of the License.
+#
+# A-SID is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+#
+# File author: Stefano D'Angelo
+#
+# Build in place with: python3 setup.py build_ext --inplace
+
+import sys
+
+from setuptools import setup, Extension
+
+setup(
+	name="asid",
+	version="1.0.4",
+	ext_modules=[
+		Extension(
+			"asid",
+			sources=[
+				"asidmodule.c",
+				"../src/asid.c",
+				"../src/mos_filter.c",
+				"../src/mos_8580_filter.c",
+				"../src/mos_6581_filter.c",
+				"../src/mos_output_buffer.c",
+				"../src/halfband.c",
+				"../src/mos_calibration.c"
+			],
+			include_dirs=["../src"],
+			libraries=[] if sys.platform == "win32" else ["m"],
+			extra_compile_args=["-O3", "-ffast-math"]
+		)
+	]
+)
@@ -20,74 +20,271 @@
 #include "asid.h"
 
 #include "common.h"
+#include "halfband.h"
+#include "mos_calibration.h"
 #include "mos_8580_filter.h"
+#include "mos_6581_filter.h"
 #include "ormath.h"
 
+#include <math.h>
+
 #define UPDATE_INTERVAL 0.01f	// seconds
+#define DECIMATION_MIN_RATE 44100.f	// lowest internal sample rate when decimating
+#define DECIMATION_BLOCK 256	// samples at the host rate
 
 enum {
 	p_cutoff,
 	p_lfo_amount,
 	p_lfo_speed,
+	p_modulated_cutoff,	// output
+	p_env_amount,
+	p_env_attack,
+	p_env_release,
 	p_n
 };
 
+// Filter models are driven through a table of kernel functions, generated
+// from each module's API, so that the rest of the engine is model-agnostic.
+// Their quality enums have the same values as asid_quality.
+
+typedef struct {
+	size_t		(*mem_req)();
+	void *		(*new_in)(void *mem);
+	void		(*set_sample_rate)(void *f, float sample_rate);
+	void		(*reset)(void *f);
+	void		(*process)(void *f, const float* x, float* y, int n_samples);
+	void		(*set_cutoff)(void *f, float value);
+	void		(*set_cutoff_curve)(void *f, const float* value);
+	void		(*set_resonance)(void *f, float value);
+	void		(*set_volume)(void *f, float value);
+	void		(*set_mode)(void *f, float bypass, float lp, float bp, float hp);
+	void		(*set_quality)(void *f, asid_quality value);
+	const int	*cutoff_map;	// 256 register values
+} filter_kernel;
+
+#define KERNEL_FUNCTIONS(t) \
+	static void *t##_new_in_k(void *mem) { return t##_new_in(mem); } \
+	static void t##_set_sample_rate_k(void *f, float sample_rate) { t##_set_sample_rate((t)f, sample_rate); } \
+	static void t##_reset_k(void *f) { t##_reset((t)f); } \
+	static void t##_process_k(void *f, const float* x, float* y, int n_samples) { t##_process((t)f, x, y, n_samples); } \
+	static void t##_set_cutoff_k(void *f, float value) { t##_set_cutoff((t)f, value); } \
+	static void t##_set_cutoff_curve_k(void *f, const float* value) { t##_set_cutoff_curve((t)f, value); } \
+	static void t##_set_resonance_k(void *f, float value) { t##_set_resonance((t)f, value); } \
+	static void t##_set_volume_k(void *f, float value) { t##_set_volume((t)f, value); } \
+	static void t##_set_mode_k(void *f, float bypass, float lp, float bp, float hp) { t##_set_mode((t)f, bypass, lp, bp, hp); } \
+	static void t##_set_quality_k(void *f, asid_quality value) { t##_set_quality((t)f, (t##_quality)value); }
+
+#define KERNEL(t, cutoff_map) \
+	{ t##_mem_req, t##_new_in_k, t##_set_sample_rate_k, t##_reset_k, t##_process_k, t##_set_cutoff_k, t##_set_cutoff_curve_k, t##_set_resonance_k, \
+	  t##_set_volume_k, t##_set_mode_k, t##_set_quality_k, cutoff_map }
+
+KERNEL_FUNCTIONS(ordsp_mos_8580_filter)
+KERNEL_FUNCTIONS(ordsp_mos_6581_filter)
+
 struct _asid {
 	// Sub-modules
-	ordsp_mos_8580_filter filter;
+	void *filters[asid_model_n][ASID_STAGES_MAX];	// all allocated, so that switching is realtime-safe, in the same memory block
+	const filter_kernel *kernel;
+	void **stages;
+	ordsp_halfband halfbands[2];	// inner (always used when decimating) and outer (4x)
+	ordsp_mos_calibration calibration;
 
 	// Coefficients
 	int update_samples;
+	int decimation_stages;		// 0 (off), 1 (2x), or 2 (4x)
+	float sample_rate;
 
 	// Parameters
 	float params[p_n];
+	asid_model model;
+	char decimation;
+	int n_stages;
+	int stage_cutoff_offset[ASID_STAGES_MAX];		// in cutoff steps (256 over the range)
+	unsigned char stage_lfo_offset[ASID_STAGES_MAX];	// in LFO phase steps (256 per cycle)
 
 	// States
 	unsigned char lfo_phase;
 	float modulated_cutoff;
 	int update_left;
+	float env;
+	float env_sum[4];	// of squared input over the current update interval, by sample position mod 4
+	int env_count;
+
+	// Buffers
+	float buf_2x[DECIMATION_BLOCK / 2];
+	float buf_4x[DECIMATION_BLOCK / 4];
 };
 
-asid asid_new() {
-	asid instance = (asid)malloc(sizeof(struct _asid));
-	if (instance == NULL)
-		return NULL;
-	instance->filter = ordsp_mos_8580_filter_new();
-	if (instance->filter == NULL) {
-		free(instance);
-		return NULL;
+static const int cutoff_map[256] = { 62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,68,68,68,68,68,69,69,69,70,70,70,71,71,71,72,72,72,73,73,73,74,74,75,75,75,76,76,77,77,78,78,79,79,80,80,81,81,82,82,83,83,84,85,85,86,87,87,88,89,89,90,91,91,92,93,94,94,95,96,97,98,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,123,124,125,126,128,129,130,131,133,134,135,137,138,139,141,142,144,145,147,148,150,151,153,154,156,157,159,161,162,164,166,167,169,171,173,174,176,178,180,182,184,185,187,189,191,193,195,197,199,201,203,206,208,210,212,214,216,219,221,223,225,228,230,232,235,237,239,242,244,247,249,252,254,257,260,262,265,268,270,273,276,278,281,284,287,290,293,296,298,301,304,307,310,313,317,320,323,326,329,332,336,339,342 };
+// Envelope follower one-pole coefficients at control rate, attack from 10 ms
+// to 200 ms, release from 20 ms to 2 s, exponentially spaced
+static const float env_attack_coeffs[16] = { 0.632121f, 0.559112f, 0.488650f, 0.422635f, 0.362270f, 0.308162f, 0.260447f, 0.218928f, 0.183196f, 0.152719f, 0.126914f, 0.105196f, 0.087008f, 0.071838f, 0.059226f, 0.048771f };
+static const float env_release_coeffs[16] = { 0.393469f, 0.307759f, 0.237067f, 0.180494f, 0.136216f, 0.102123f, 0.076186f, 0.056629f, 0.041978f, 0.031055f, 0.022941f, 0.016928f, 0.012481f, 0.009197f, 0.006774f, 0.004988f };
+static const unsigned char lfo_increments[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 16, 21, 28, 37, 49, 64 };
+static const signed char lfo_map[4096] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,2,2,2,2,2,3,3,3,3,3,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,7,7,7,7,7,7,7,7,7,6,6,6,6,6,6,6,5,5,5,5,5,5,4,4,4,4,4,3,3,3,3,3,2,2,2,2,2,1,1,1,1,1,0,0,0,0,0,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-3,-3,-3,-3,-3,-4,-4,-4,-4,-4,-5,-5,-5,-5,-5,-5,-6,-6,-6,-6,-6,-6,-6,-7,-7,-7,-7,-7,-7,-7,-7,-7,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-7,-7,-7,-7,-7,-7,-7,-7,-7,-6,-6,-6,-6,-6,-6,-6,-5,-5,-5,-5,-5,-5,-4,-4,-4,-4,-4,-3,-3,-3,-3,-3,-2,-2,-2,-2,-2,-1,-1,-1,-1,-1,0,0,0,0,1,1,2,2,2,3,3,4,4,5,5,5,6,6,6,7,7,8,8,8,9,9,9,10,10,10,11,11,11,12,12,12,13,13,13,13,14,14,14,14,15,15,15,15,15,15,16,16,16,16,16,16,16,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,16,16,16,16,16,16,16,15,15,15,15,15,15,14,14,14,14,13,13,13,13,12,12,12,11,11,11,10,10,10,9,9,9,8,8,8,7,7,6,6,6,5,5,5,4,4,3,3,2,2,2,1,1,0,0,0,-1,-1,-2,-2,-2,-3,-3,-4,-4,-5,-5,-5,-6,-6,-6,-7,-7,-8,-8,-8,-9,-9,-9,-10,-10,-10,-11,-11,-11,-12,-12,-12,-13,-13,-13,-13,-14,-14,-14,-14,-15,-15,-15,-15,-15,-15,-16,-16,-16,-16,-16,-16,-16,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-16,-16,-16,-16,-16,-16,-16,-15,-15,-15,-15,-15,-15,-14,-14,-14,-14,-13,-13,-13,-13,-12,-12,-12,-11,-11,-11,-10,-10,-10,-9,-9,-9,-8,-8,-8,-7,-7,-6,-6,-6,-5,-5,-5,-4,-4,-3,-3,-2,-2,-2,-1,-1,0,0,1,1,2,2,3,4,4,5,6,6,7,7,8,9,9,10,10,11,11,12,13,13,14,14,15,15,16,16,17,17,18,18,18,19,19,20,20,20,21,21,21,22,22,22,23,23,23,23,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,24,24,24,24,24,23,23,23,23,22,22,22,21,21,21,20,20,20,19,19,18,18,18,17,17,16,16,15,15,14,14,13,13,12,11,11,10,10,9,9,8,7,7,6,6,5,4,4,3,2,2,1,1,0,-1,-1,-2,-2,-3,-4,-4,-5,-6,-6,-7,-7,-8,-9,-9,-10,-10,-11,-11,-12,-13,-13,-14,-14,-15,-15,-16,-16,-17,-17,-18,-18,-18,-19,-19,-20,-20,-20,-21,-21,-21,-22,-22,-22,-23,-23,-23,-23,-24,-24,-24,-24,-24,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-24,-24,-24,-24,-24,-23,-23,-23,-23,-22,-22,-22,-21,-21,-21,-20,-20,-20,-19,-19,-18,-18,-18,-17,-17,-16,-16,-15,-15,-14,-14,-13,-13,-12,-11,-11,-10,-10,-9,-9,-8,-7,-7,-6,-6,-5,-4,-4,-3,-2,-2,-1,-1,0,1,2,2,3,4,5,6,7,7,8,9,10,11,11,12,13,14,14,15,16,17,17,18,19,20,20,21,21,22,23,23,24,25,25,26,26,27,27,28,28,29,29,29,30,30,31,31,31,32,32,32,32,33,33,33,33,33,34,34,34,34,34,34,34,34,34,34,34,34,34,33,33,33,33,33,32,32,32,32,31,31,31,30,30,29,29,29,28,28,27,27,26,26,25,25,24,23,23,22,21,21,20,20,19,18,17,17,16,15,14,14,13,12,11,11,10,9,8,7,7,6,5,4,3,2,2,1,0,-1,-2,-2,-3,-4,-5,-6,-7,-7,-8,-9,-10,-11,-11,-12,-13,-14,-14,-15,-16,-17,-17,-18,-19,-20,-20,-21,-21,-22,-23,-23,-24,-25,-25,-26,-26,-27,-27,-28,-28,-29,-29,-29,-30,-30,-31,-31,-31,-32,-32,-32,-32,-33,-33,-33,-33,-33,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-33,-33,-33,-33,-33,-32,-32,-32,-32,-31,-31,-31,-30,-30,-29,-29,-29,-28,-28,-27,-27,-26,-26,-25,-25,-24,-23,-23,-22,-21,-21,-20,-20,-19,-18,-17,-17,-16,-15,-14,-14,-13,-12,-11,-11,-10,-9,-8,-7,-7,-6,-5,-4,-3,-2,-2,-1,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,24,25,26,27,28,28,29,30,31,31,32,33,33,34,35,35,36,36,37,37,38,38,39,39,39,40,40,41,41,41,41,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,41,41,41,41,40,40,39,39,39,38,38,37,37,36,36,35,35,34,33,33,32,31,31,30,29,28,28,27,26,25,24,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0,-1,-2,-3,-4,-5,-6,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-17,-18,-19,-20,-21,-22,-23,-24,-24,-25,-26,-27,-28,-28,-29,-30,-31,-31,-32,-33,-33,-34,-35,-35,-36,-36,-37,-37,-38,-38,-39,-39,-39,-40,-40,-41,-41,-41,-41,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-41,-41,-41,-41,-40,-40,-39,-39,-39,-38,-38,-37,-37,-36,-36,-35,-35,-34,-33,-33,-32,-31,-31,-30,-29,-28,-28,-27,-26,-25,-24,-24,-23,-22,-21,-20,-19,-18,-17,-16,-15,-14,-13,-12,-11,-10,-9,-8,-7,-6,-5,-4,-3,-2,-1,0,1,2,4,5,6,7,9,10,11,12,14,15,16,17,18,19,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,38,39,40,41,42,42,43,44,44,45,45,46,46,47,47,48,48,49,49,49,50,50,50,50,50,51,51,51,51,51,51,51,51,51,50,50,50,50,50,49,49,49,48,48,47,47,46,46,45,45,44,44,43,42,42,41,40,39,38,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,19,18,17,16,15,14,12,11,10,9,7,6,5,4,2,1,0,-1,-2,-4,-5,-6,-7,-9,-10,-11,-12,-14,-15,-16,-17,-18,-19,-21,-22,-23,-24,-25,-26,-27,-28,-29,-30,-31,-32,-33,-34,-35,-36,-37,-38,-38,-39,-40,-41,-42,-42,-43,-44,-44,-45,-45,-46,-46,-47,-47,-48,-48,-49,-49,-49,-50,-50,-50,-50,-50,-51,-51,-51,-51,-51,-51,-51,-51,-51,-50,-50,-50,-50,-50,-49,-49,-49,-48,-48,-47,-47,-46,-46,-45,-45,-44,-44,-43,-42,-42,-41,-40,-39,-38,-38,-37,-36,-35,-34,-33,-32,-31,-30,-29,-28,-27,-26,-25,-24,-23,-22,-21,-19,-18,-17,-16,-15,-14,-12,-11,-10,-9,-7,-6,-5,-4,-2,-1,0,1,3,4,6,7,9,10,12,13,14,16,17,19,20,21,23,24,25,27,28,29,30,32,33,34,35,36,38,39,40,41,42,43,44,45,46,47,48,48,49,50,51,52,52,53,54,54,55,55,56,56,57,57,57,58,58,58,59,59,59,59,59,59,59,59,59,59,59,59,59,58,58,58,57,57,57,56,56,55,55,54,54,53,52,52,51,50,49,48,48,47,46,45,44,43,42,41,40,39,38,36,35,34,33,32,30,29,28,27,25,24,23,21,20,19,17,16,14,13,12,10,9,7,6,4,3,1,0,-1,-3,-4,-6,-7,-9,-10,-12,-13,-14,-16,-17,-19,-20,-21,-23,-24,-25,-27,-28,-29,-30,-32,-33,-34,-35,-36,-38,-39,-40,-41,-42,-43,-44,-45,-46,-47,-48,-48,-49,-50,-51,-52,-52,-53,-54,-54,-55,-55,-56,-56,-57,-57,-57,-58,-58,-58,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-58,-58,-58,-57,-57,-57,-56,-56,-55,-55,-54,-54,-53,-52,-52,-51,-50,-49,-48,-48,-47,-46,-45,-44,-43,-42,-41,-40,-39,-38,-36,-35,-34,-33,-32,-30,-29,-28,-27,-25,-24,-23,-21,-20,-19,-17,-16,-14,-13,-12,-10,-9,-7,-6,-4,-3,-1,0,2,3,5,7,8,10,12,13,15,16,18,20,21,23,24,26,27,29,30,32,33,35,36,38,39,40,42,43,44,45,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,61,62,63,63,64,64,65,65,66,66,66,67,67,67,67,68,68,68,68,68,68,68,67,67,67,67,66,66,66,65,65,64,64,63,63,62,61,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,45,44,43,42,40,39,38,36,35,33,32,30,29,27,26,24,23,21,20,18,16,15,13,12,10,8,7,5,3,2,0,-2,-3,-5,-7,-8,-10,-12,-13,-15,-16,-18,-20,-21,-23,-24,-26,-27,-29,-30,-32,-33,-35,-36,-38,-39,-40,-42,-43,-44,-45,-47,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-59,-60,-61,-61,-62,-63,-63,-64,-64,-65,-65,-66,-66,-66,-67,-67,-67,-67,-68,-68,-68,-68,-68,-68,-68,-67,-67,-67,-67,-66,-66,-66,-65,-65,-64,-64,-63,-63,-62,-61,-61,-60,-59,-58,-57,-56,-55,-54,-53,-52,-51,-50,-49,-48,-47,-45,-44,-43,-42,-40,-39,-38,-36,-35,-33,-32,-30,-29,-27,-26,-24,-23,-21,-20,-18,-16,-15,-13,-12,-10,-8,-7,-5,-3,-2,0,2,4,6,7,9,11,13,15,17,19,20,22,24,26,27,29,31,33,34,36,38,39,41,42,44,45,47,48,50,51,53,54,55,56,58,59,60,61,62,63,64,65,66,67,68,69,70,70,71,72,72,73,73,74,74,75,75,75,76,76,76,76,76,76,76,76,76,76,76,75,75,75,74,74,73,73,72,72,71,70,70,69,68,67,66,65,64,63,62,61,60,59,58,56,55,54,53,51,50,48,47,45,44,42,41,39,38,36,34,33,31,29,27,26,24,22,20,19,17,15,13,11,9,7,6,4,2,0,-2,-4,-6,-7,-9,-11,-13,-15,-17,-19,-20,-22,-24,-26,-27,-29,-31,-33,-34,-36,-38,-39,-41,-42,-44,-45,-47,-48,-50,-51,-53,-54,-55,-56,-58,-59,-60,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-70,-71,-72,-72,-73,-73,-74,-74,-75,-75,-75,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-75,-75,-75,-74,-74,-73,-73,-72,-72,-71,-70,-70,-69,-68,-67,-66,-65,-64,-63,-62,-61,-60,-59,-58,-56,-55,-54,-53,-51,-50,-48,-47,-45,-44,-42,-41,-39,-38,-36,-34,-33,-31,-29,-27,-26,-24,-22,-20,-19,-17,-15,-13,-11,-9,-7,-6,-4,-2,0,2,4,6,8,10,12,14,17,19,21,23,25,27,29,30,32,34,36,38,40,42,44,45,47,49,50,52,54,55,57,58,60,61,63,64,65,67,68,69,70,72,73,74,75,76,77,77,78,79,80,80,81,82,82,83,83,83,84,84,84,84,85,85,85,85,85,84,84,84,84,83,83,83,82,82,81,80,80,79,78,77,77,76,75,74,73,72,70,69,68,67,65,64,63,61,60,58,57,55,54,52,50,49,47,45,44,42,40,38,36,34,32,30,29,27,25,23,21,19,17,14,12,10,8,6,4,2,0,-2,-4,-6,-8,-10,-12,-14,-17,-19,-21,-23,-25,-27,-29,-30,-32,-34,-36,-38,-40,-42,-44,-45,-47,-49,-50,-52,-54,-55,-57,-58,-60,-61,-63,-64,-65,-67,-68,-69,-70,-72,-73,-74,-75,-76,-77,-77,-78,-79,-80,-80,-81,-82,-82,-83,-83,-83,-84,-84,-84,-84,-85,-85,-85,-85,-85,-84,-84,-84,-84,-83,-83,-83,-82,-82,-81,-80,-80,-79,-78,-77,-77,-76,-75,-74,-73,-72,-70,-69,-68,-67,-65,-64,-63,-61,-60,-58,-57,-55,-54,-52,-50,-49,-47,-45,-44,-42,-40,-38,-36,-34,-32,-30,-29,-27,-25,-23,-21,-19,-17,-14,-12,-10,-8,-6,-4,-2,0,2,5,7,9,11,14,16,18,20,23,25,27,29,31,34,36,38,40,42,44,46,48,50,52,54,55,57,59,61,63,64,66,67,69,71,72,73,75,76,77,79,80,81,82,83,84,85,86,87,88,88,89,90,90,91,91,92,92,92,93,93,93,93,93,93,93,93,93,92,92,92,91,91,90,90,89,88,88,87,86,85,84,83,82,81,80,79,77,76,75,73,72,71,69,67,66,64,63,61,59,57,55,54,52,50,48,46,44,42,40,38,36,34,31,29,27,25,23,20,18,16,14,11,9,7,5,2,0,-2,-5,-7,-9,-11,-14,-16,-18,-20,-23,-25,-27,-29,-31,-34,-36,-38,-40,-42,-44,-46,-48,-50,-52,-54,-55,-57,-59,-61,-63,-64,-66,-67,-69,-71,-72,-73,-75,-76,-77,-79,-80,-81,-82,-83,-84,-85,-86,-87,-88,-88,-89,-90,-90,-91,-91,-92,-92,-92,-93,-93,-93,-93,-93,-93,-93,-93,-93,-92,-92,-92,-91,-91,-90,-90,-89,-88,-88,-87,-86,-85,-84,-83,-82,-81,-80,-79,-77,-76,-75,-73,-72,-71,-69,-67,-66,-64,-63,-61,-59,-57,-55,-54,-52,-50,-48,-46,-44,-42,-40,-38,-36,-34,-31,-29,-27,-25,-23,-20,-18,-16,-14,-11,-9,-7,-5,-2,0,2,5,7,10,12,15,17,20,22,25,27,29,32,34,37,39,41,43,46,48,50,52,54,56,59,61,63,64,66,68,70,72,74,75,77,79,80,82,83,84,86,87,88,90,91,92,93,94,95,96,96,97,98,99,99,100,100,101,101,101,101,101,102,102,102,101,101,101,101,101,100,100,99,99,98,97,96,96,95,94,93,92,91,90,88,87,86,84,83,82,80,79,77,75,74,72,70,68,66,64,63,61,59,56,54,52,50,48,46,43,41,39,37,34,32,29,27,25,22,20,17,15,12,10,7,5,2,0,-2,-5,-7,-10,-12,-15,-17,-20,-22,-25,-27,-29,-32,-34,-37,-39,-41,-43,-46,-48,-50,-52,-54,-56,-59,-61,-63,-64,-66,-68,-70,-72,-74,-75,-77,-79,-80,-82,-83,-84,-86,-87,-88,-90,-91,-92,-93,-94,-95,-96,-96,-97,-98,-99,-99,-100,-100,-101,-101,-101,-101,-101,-102,-102,-102,-101,-101,-101,-101,-101,-100,-100,-99,-99,-98,-97,-96,-96,-95,-94,-93,-92,-91,-90,-88,-87,-86,-84,-83,-82,-80,-79,-77,-75,-74,-72,-70,-68,-66,-64,-63,-61,-59,-56,-54,-52,-50,-48,-46,-43,-41,-39,-37,-34,-32,-29,-27,-25,-22,-20,-17,-15,-12,-10,-7,-5,-2,0,3,5,8,11,13,16,19,21,24,27,29,32,35,37,40,42,45,47,49,52,54,57,59,61,63,66,68,70,72,74,76,78,80,82,83,85,87,88,90,92,93,94,96,97,98,99,101,102,103,104,105,105,106,107,107,108,108,109,109,110,110,110,110,110,110,110,110,110,109,109,108,108,107,107,106,105,105,104,103,102,101,99,98,97,96,94,93,92,90,88,87,85,83,82,80,78,76,74,72,70,68,66,63,61,59,57,54,52,49,47,45,42,40,37,35,32,29,27,24,21,19,16,13,11,8,5,3,0,-3,-5,-8,-11,-13,-16,-19,-21,-24,-27,-29,-32,-35,-37,-40,-42,-45,-47,-49,-52,-54,-57,-59,-61,-63,-66,-68,-70,-72,-74,-76,-78,-80,-82,-83,-85,-87,-88,-90,-92,-93,-94,-96,-97,-98,-99,-101,-102,-103,-104,-105,-105,-106,-107,-107,-108,-108,-109,-109,-110,-110,-110,-110,-110,-110,-110,-110,-110,-109,-109,-108,-108,-107,-107,-106,-105,-105,-104,-103,-102,-101,-99,-98,-97,-96,-94,-93,-92,-90,-88,-87,-85,-83,-82,-80,-78,-76,-74,-72,-70,-68,-66,-63,-61,-59,-57,-54,-52,-49,-47,-45,-42,-40,-37,-35,-32,-29,-27,-24,-21,-19,-16,-13,-11,-8,-5,-3,0,3,6,9,12,15,17,20,23,26,29,32,34,37,40,43,45,48,51,53,56,58,61,63,66,68,71,73,75,77,80,82,84,86,88,90,92,93,95,97,99,100,102,103,105,106,107,108,110,111,112,113,113,114,115,116,116,117,117,118,118,118,118,118,119,118,118,118,118,118,117,117,116,116,115,114,113,113,112,111,110,108,107,106,105,103,102,100,99,97,95,93,92,90,88,86,84,82,80,77,75,73,71,68,66,63,61,58,56,53,51,48,45,43,40,37,34,32,29,26,23,20,17,15,12,9,6,3,0,-3,-6,-9,-12,-15,-17,-20,-23,-26,-29,-32,-34,-37,-40,-43,-45,-48,-51,-53,-56,-58,-61,-63,-66,-68,-71,-73,-75,-77,-80,-82,-84,-86,-88,-90,-92,-93,-95,-97,-99,-100,-102,-103,-105,-106,-107,-108,-110,-111,-112,-113,-113,-114,-115,-116,-116,-117,-117,-118,-118,-118,-118,-118,-119,-118,-118,-118,-118,-118,-117,-117,-116,-116,-115,-114,-113,-113,-112,-111,-110,-108,-107,-106,-105,-103,-102,-100,-99,-97,-95,-93,-92,-90,-88,-86,-84,-82,-80,-77,-75,-73,-71,-68,-66,-63,-61,-58,-56,-53,-51,-48,-45,-43,-40,-37,-34,-32,-29,-26,-23,-20,-17,-15,-12,-9,-6,-3,0,3,6,9,12,16,19,22,25,28,31,34,37,40,43,46,49,51,54,57,60,63,65,68,71,73,76,78,81,83,85,88,90,92,94,96,98,100,102,104,106,107,109,111,112,113,115,116,117,118,120,121,122,122,123,124,125,125,126,126,126,127,127,127,127,127,127,127,126,126,126,125,125,124,123,122,122,121,120,118,117,116,115,113,112,111,109,107,106,104,102,100,98,96,94,92,90,88,85,83,81,78,76,73,71,68,65,63,60,57,54,51,49,46,43,40,37,34,31,28,25,22,19,16,12,9,6,3,0,-3,-6,-9,-12,-16,-19,-22,-25,-28,-31,-34,-37,-40,-43,-46,-49,-51,-54,-57,-60,-63,-65,-68,-71,-73,-76,-78,-81,-83,-85,-88,-90,-92,-94,-96,-98,-100,-102,-104,-106,-107,-109,-111,-112,-113,-115,-116,-117,-118,-120,-121,-122,-122,-123,-124,-125,-125,-126,-126,-126,-127,-127,-127,-127,-127,-127,-127,-126,-126,-126,-125,-125,-124,-123,-122,-122,-121,-120,-118,-117,-116,-115,-113,-112,-111,-109,-107,-106,-104,-102,-100,-98,-96,-94,-92,-90,-88,-85,-83,-81,-78,-76,-73,-71,-68,-65,-63,-60,-57,-54,-51,-49,-46,-43,-40,-37,-34,-31,-28,-25,-22,-19,-16,-12,-9,-6,-3,0 };
+
+// 6581 register values with the same frequencies as cutoff_map on the 8580,
+// from the part of the curve below 1024
+
+static int cutoff_map_6581[256];
+static volatile long cutoff_map_6581_state;
+
+static void cutoff_map_6581_init(void) {
+	for (int i = 0; i < 256; i++) {
+		const float freq = (13164.18911276704f / 2047.f) * cutoff_map[i];
+		int lo = 0;
+		int hi = 1023;
+		while (hi - lo > 1) {
+			const int m = (lo + hi) >> 1;
+			if (ordsp_mos_6581_filter_get_cutoff_frequency((1.f / 2047.f) * m) < freq)
+				lo = m;
+			else
+				hi = m;
+		}
+		const float f_lo = ordsp_mos_6581_filter_get_cutoff_frequency((1.f / 2047.f) * lo);
+		const float f_hi = ordsp_mos_6581_filter_get_cutoff_frequency((1.f / 2047.f) * hi);
+		cutoff_map_6581[i] = freq - f_lo < f_hi - freq ? lo : hi;
 	}
+}
+
+static const filter_kernel kernels[asid_model_n] = {
+	KERNEL(ordsp_mos_8580_filter, cutoff_map),
+	KERNEL(ordsp_mos_6581_filter, cutoff_map_6581)
+};
+
+#define MEM_ALIGN(n)	(((n) + 15) & ~(size_t)15)
+
+size_t asid_mem_req() {
+	size_t n = MEM_ALIGN(sizeof(struct _asid));
+	for (int m = 0; m < asid_model_n; m++)
+		n += ASID_STAGES_MAX * MEM_ALIGN(kernels[m].mem_req());
+	return n + 2 * MEM_ALIGN(ordsp_halfband_mem_req());
+}
 
-	ordsp_mos_8580_filter_set_resonance(instance->filter, 1.f);
-	ordsp_mos_8580_filter_set_volume(instance->filter, 1.f);
-	ordsp_mos_8580_filter_set_mode(instance->filter, 0.f, 0.f, 1.f, 0.f);
+asid asid_new() {
+	void *mem = malloc(asid_mem_req());
+	return mem != NULL ? asid_new_in(mem) : NULL;
+}
+
+asid asid_new_in(void* mem) {
+	asid instance = (asid)mem;
+	char *p = (char *)mem + MEM_ALIGN(sizeof(struct _asid));
+	ordsp_once(&cutoff_map_6581_state, cutoff_map_6581_init);
+	for (int m = 0; m < asid_model_n; m++)
+		for (int s = 0; s < ASID_STAGES_MAX; s++) {
+			void *f = kernels[m].new_in(p);
+			p += MEM_ALIGN(kernels[m].mem_req());
+			instance->filters[m][s] = f;
+
+			kernels[m].set_resonance(f, 1.f);
+			kernels[m].set_volume(f, 1.f);
+			kernels[m].set_mode(f, 0.f, 0.f, 1.f, 0.f);
+		}
+
+	instance->halfbands[0] = ordsp_halfband_new_in(p, ordsp_halfband_sharp);
+	instance->halfbands[1] = ordsp_halfband_new_in(p + MEM_ALIGN(ordsp_halfband_mem_req()), ordsp_halfband_relaxed);
+
+	instance->model = asid_model_8580;
+	instance->kernel = kernels + asid_model_8580;
+	instance->stages = instance->filters[asid_model_8580];
+
+	instance->params[p_cutoff] = 1.f;
+	instance->params[p_lfo_amount] = 0.f;
+	instance->params[p_lfo_speed] = 0.5f;
+	instance->params[p_modulated_cutoff] = 0.f;
+	instance->params[p_env_amount] = 0.f;
+	instance->params[p_env_attack] = 0.3f;
+	instance->params[p_env_release] = 0.5f;
+	instance->modulated_cutoff = 0.f;
+
+	instance->calibration = NULL;
+	instance->decimation = 0;
+	instance->decimation_stages = 0;
+	instance->sample_rate = 44100.f;
+	instance->n_stages = 1;
+	for (int s = 0; s < ASID_STAGES_MAX; s++) {
+		instance->stage_cutoff_offset[s] = 0;
+		instance->stage_lfo_offset[s] = 0;
+	}
 	
 	return instance;
 }
 
+void asid_fini(asid instance) {
+	if (instance->calibration != NULL)
+		ordsp_mos_calibration_close(instance->calibration);
+}
+
 void asid_free(asid instance) {
-	ordsp_mos_8580_filter_free(instance->filter);
+	asid_fini(instance);
 	free(instance);
 }
 
-void asid_set_sample_rate(asid instance, float sample_rate) {
-	ordsp_mos_8580_filter_set_sample_rate(instance->filter, sample_rate);
+// Internal rate is the host rate over 2 or 4, if decimation is on and that
+// keeps it >= DECIMATION_MIN_RATE
+static void update_rate(asid instance) {
+	instance->decimation_stages = 0;
+	if (instance->decimation)
+		while (instance->decimation_stages < 2 && instance->sample_rate >= (float)(2 << instance->decimation_stages) * DECIMATION_MIN_RATE)
+			instance->decimation_stages++;
+	const float rate = instance->sample_rate / (float)(1 << instance->decimation_stages);
+
+	for (int m = 0; m < asid_model_n; m++)
+		for (int s = 0; s < ASID_STAGES_MAX; s++)
+			kernels[m].set_sample_rate(instance->filters[m][s], rate);
+
+	instance->update_samples = (int)ormath_roundf(UPDATE_INTERVAL * rate);
+}
 
-	instance->update_samples = (int)ormath_roundf(UPDATE_INTERVAL * sample_rate);
+void asid_set_sample_rate(asid instance, float sample_rate) {
+	instance->sample_rate = sample_rate;
+	update_rate(instance);
 }
 
 void asid_reset(asid instance) {
-	ordsp_mos_8580_filter_reset(instance->filter);
+	for (int s = 0; s < instance->n_stages; s++)
+		instance->kernel->reset(instance->stages[s]);
+	ordsp_halfband_reset(instance->halfbands[0]);
+	ordsp_halfband_reset(instance->halfbands[1]);
 	
 	instance->update_left = 0;
 	instance->lfo_phase = 0;
+	instance->env = 0.f;
+	for (int i = 0; i < 4; i++)
+		instance->env_sum[i] = 0.f;
+	instance->env_count = 0;
 }
 
-static const int cutoff_map[256] = { 62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,68,68,68,68,68,69,69,69,70,70,70,71,71,71,72,72,72,73,73,73,74,74,75,75,75,76,76,77,77,78,78,79,79,80,80,81,81,82,82,83,83,84,85,85,86,87,87,88,89,89,90,91,91,92,93,94,94,95,96,97,98,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,123,124,125,126,128,129,130,131,133,134,135,137,138,139,141,142,144,145,147,148,150,151,153,154,156,157,159,161,162,164,166,167,169,171,173,174,176,178,180,182,184,185,187,189,191,193,195,197,199,201,203,206,208,210,212,214,216,219,221,223,225,228,230,232,235,237,239,242,244,247,249,252,254,257,260,262,265,268,270,273,276,278,281,284,287,290,293,296,298,301,304,307,310,313,317,320,323,326,329,332,336,339,342 };
-static const unsigned char lfo_increments[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 16, 21, 28, 37, 49, 64 };
-static const signed char lfo_map[4096] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,2,2,2,2,2,3,3,3,3,3,4,4,4,4,4,5,5,5,5,5,5,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,7,7,7,7,7,7,7,7,7,6,6,6,6,6,6,6,5,5,5,5,5,5,4,4,4,4,4,3,3,3,3,3,2,2,2,2,2,1,1,1,1,1,0,0,0,0,0,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-3,-3,-3,-3,-3,-4,-4,-4,-4,-4,-5,-5,-5,-5,-5,-5,-6,-6,-6,-6,-6,-6,-6,-7,-7,-7,-7,-7,-7,-7,-7,-7,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-8,-7,-7,-7,-7,-7,-7,-7,-7,-7,-6,-6,-6,-6,-6,-6,-6,-5,-5,-5,-5,-5,-5,-4,-4,-4,-4,-4,-3,-3,-3,-3,-3,-2,-2,-2,-2,-2,-1,-1,-1,-1,-1,0,0,0,0,1,1,2,2,2,3,3,4,4,5,5,5,6,6,6,7,7,8,8,8,9,9,9,10,10,10,11,11,11,12,12,12,13,13,13,13,14,14,14,14,15,15,15,15,15,15,16,16,16,16,16,16,16,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,16,16,16,16,16,16,16,15,15,15,15,15,15,14,14,14,14,13,13,13,13,12,12,12,11,11,11,10,10,10,9,9,9,8,8,8,7,7,6,6,6,5,5,5,4,4,3,3,2,2,2,1,1,0,0,0,-1,-1,-2,-2,-2,-3,-3,-4,-4,-5,-5,-5,-6,-6,-6,-7,-7,-8,-8,-8,-9,-9,-9,-10,-10,-10,-11,-11,-11,-12,-12,-12,-13,-13,-13,-13,-14,-14,-14,-14,-15,-15,-15,-15,-15,-15,-16,-16,-16,-16,-16,-16,-16,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-17,-16,-16,-16,-16,-16,-16,-16,-15,-15,-15,-15,-15,-15,-14,-14,-14,-14,-13,-13,-13,-13,-12,-12,-12,-11,-11,-11,-10,-10,-10,-9,-9,-9,-8,-8,-8,-7,-7,-6,-6,-6,-5,-5,-5,-4,-4,-3,-3,-2,-2,-2,-1,-1,0,0,1,1,2,2,3,4,4,5,6,6,7,7,8,9,9,10,10,11,11,12,13,13,14,14,15,15,16,16,17,17,18,18,18,19,19,20,20,20,21,21,21,22,22,22,23,23,23,23,24,24,24,24,24,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,24,24,24,24,24,23,23,23,23,22,22,22,21,21,21,20,20,20,19,19,18,18,18,17,17,16,16,15,15,14,14,13,13,12,11,11,10,10,9,9,8,7,7,6,6,5,4,4,3,2,2,1,1,0,-1,-1,-2,-2,-3,-4,-4,-5,-6,-6,-7,-7,-8,-9,-9,-10,-10,-11,-11,-12,-13,-13,-14,-14,-15,-15,-16,-16,-17,-17,-18,-18,-18,-19,-19,-20,-20,-20,-21,-21,-21,-22,-22,-22,-23,-23,-23,-23,-24,-24,-24,-24,-24,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-25,-24,-24,-24,-24,-24,-23,-23,-23,-23,-22,-22,-22,-21,-21,-21,-20,-20,-20,-19,-19,-18,-18,-18,-17,-17,-16,-16,-15,-15,-14,-14,-13,-13,-12,-11,-11,-10,-10,-9,-9,-8,-7,-7,-6,-6,-5,-4,-4,-3,-2,-2,-1,-1,0,1,2,2,3,4,5,6,7,7,8,9,10,11,11,12,13,14,14,15,16,17,17,18,19,20,20,21,21,22,23,23,24,25,25,26,26,27,27,28,28,29,29,29,30,30,31,31,31,32,32,32,32,33,33,33,33,33,34,34,34,34,34,34,34,34,34,34,34,34,34,33,33,33,33,33,32,32,32,32,31,31,31,30,30,29,29,29,28,28,27,27,26,26,25,25,24,23,23,22,21,21,20,20,19,18,17,17,16,15,14,14,13,12,11,11,10,9,8,7,7,6,5,4,3,2,2,1,0,-1,-2,-2,-3,-4,-5,-6,-7,-7,-8,-9,-10,-11,-11,-12,-13,-14,-14,-15,-16,-17,-17,-18,-19,-20,-20,-21,-21,-22,-23,-23,-24,-25,-25,-26,-26,-27,-27,-28,-28,-29,-29,-29,-30,-30,-31,-31,-31,-32,-32,-32,-32,-33,-33,-33,-33,-33,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-34,-33,-33,-33,-33,-33,-32,-32,-32,-32,-31,-31,-31,-30,-30,-29,-29,-29,-28,-28,-27,-27,-26,-26,-25,-25,-24,-23,-23,-22,-21,-21,-20,-20,-19,-18,-17,-17,-16,-15,-14,-14,-13,-12,-11,-11,-10,-9,-8,-7,-7,-6,-5,-4,-3,-2,-2,-1,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,24,25,26,27,28,28,29,30,31,31,32,33,33,34,35,35,36,36,37,37,38,38,39,39,39,40,40,41,41,41,41,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,41,41,41,41,40,40,39,39,39,38,38,37,37,36,36,35,35,34,33,33,32,31,31,30,29,28,28,27,26,25,24,24,23,22,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0,-1,-2,-3,-4,-5,-6,-7,-8,-9,-10,-11,-12,-13,-14,-15,-16,-17,-18,-19,-20,-21,-22,-23,-24,-24,-25,-26,-27,-28,-28,-29,-30,-31,-31,-32,-33,-33,-34,-35,-35,-36,-36,-37,-37,-38,-38,-39,-39,-39,-40,-40,-41,-41,-41,-41,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-42,-41,-41,-41,-41,-40,-40,-39,-39,-39,-38,-38,-37,-37,-36,-36,-35,-35,-34,-33,-33,-32,-31,-31,-30,-29,-28,-28,-27,-26,-25,-24,-24,-23,-22,-21,-20,-19,-18,-17,-16,-15,-14,-13,-12,-11,-10,-9,-8,-7,-6,-5,-4,-3,-2,-1,0,1,2,4,5,6,7,9,10,11,12,14,15,16,17,18,19,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,38,39,40,41,42,42,43,44,44,45,45,46,46,47,47,48,48,49,49,49,50,50,50,50,50,51,51,51,51,51,51,51,51,51,50,50,50,50,50,49,49,49,48,48,47,47,46,46,45,45,44,44,43,42,42,41,40,39,38,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,19,18,17,16,15,14,12,11,10,9,7,6,5,4,2,1,0,-1,-2,-4,-5,-6,-7,-9,-10,-11,-12,-14,-15,-16,-17,-18,-19,-21,-22,-23,-24,-25,-26,-27,-28,-29,-30,-31,-32,-33,-34,-35,-36,-37,-38,-38,-39,-40,-41,-42,-42,-43,-44,-44,-45,-45,-46,-46,-47,-47,-48,-48,-49,-49,-49,-50,-50,-50,-50,-50,-51,-51,-51,-51,-51,-51,-51,-51,-51,-50,-50,-50,-50,-50,-49,-49,-49,-48,-48,-47,-47,-46,-46,-45,-45,-44,-44,-43,-42,-42,-41,-40,-39,-38,-38,-37,-36,-35,-34,-33,-32,-31,-30,-29,-28,-27,-26,-25,-24,-23,-22,-21,-19,-18,-17,-16,-15,-14,-12,-11,-10,-9,-7,-6,-5,-4,-2,-1,0,1,3,4,6,7,9,10,12,13,14,16,17,19,20,21,23,24,25,27,28,29,30,32,33,34,35,36,38,39,40,41,42,43,44,45,46,47,48,48,49,50,51,52,52,53,54,54,55,55,56,56,57,57,57,58,58,58,59,59,59,59,59,59,59,59,59,59,59,59,59,58,58,58,57,57,57,56,56,55,55,54,54,53,52,52,51,50,49,48,48,47,46,45,44,43,42,41,40,39,38,36,35,34,33,32,30,29,28,27,25,24,23,21,20,19,17,16,14,13,12,10,9,7,6,4,3,1,0,-1,-3,-4,-6,-7,-9,-10,-12,-13,-14,-16,-17,-19,-20,-21,-23,-24,-25,-27,-28,-29,-30,-32,-33,-34,-35,-36,-38,-39,-40,-41,-42,-43,-44,-45,-46,-47,-48,-48,-49,-50,-51,-52,-52,-53,-54,-54,-55,-55,-56,-56,-57,-57,-57,-58,-58,-58,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-59,-58,-58,-58,-57,-57,-57,-56,-56,-55,-55,-54,-54,-53,-52,-52,-51,-50,-49,-48,-48,-47,-46,-45,-44,-43,-42,-41,-40,-39,-38,-36,-35,-34,-33,-32,-30,-29,-28,-27,-25,-24,-23,-21,-20,-19,-17,-16,-14,-13,-12,-10,-9,-7,-6,-4,-3,-1,0,2,3,5,7,8,10,12,13,15,16,18,20,21,23,24,26,27,29,30,32,33,35,36,38,39,40,42,43,44,45,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,61,62,63,63,64,64,65,65,66,66,66,67,67,67,67,68,68,68,68,68,68,68,67,67,67,67,66,66,66,65,65,64,64,63,63,62,61,61,60,59,58,57,56,55,54,53,52,51,50,49,48,47,45,44,43,42,40,39,38,36,35,33,32,30,29,27,26,24,23,21,20,18,16,15,13,12,10,8,7,5,3,2,0,-2,-3,-5,-7,-8,-10,-12,-13,-15,-16,-18,-20,-21,-23,-24,-26,-27,-29,-30,-32,-33,-35,-36,-38,-39,-40,-42,-43,-44,-45,-47,-48,-49,-50,-51,-52,-53,-54,-55,-56,-57,-58,-59,-60,-61,-61,-62,-63,-63,-64,-64,-65,-65,-66,-66,-66,-67,-67,-67,-67,-68,-68,-68,-68,-68,-68,-68,-67,-67,-67,-67,-66,-66,-66,-65,-65,-64,-64,-63,-63,-62,-61,-61,-60,-59,-58,-57,-56,-55,-54,-53,-52,-51,-50,-49,-48,-47,-45,-44,-43,-42,-40,-39,-38,-36,-35,-33,-32,-30,-29,-27,-26,-24,-23,-21,-20,-18,-16,-15,-13,-12,-10,-8,-7,-5,-3,-2,0,2,4,6,7,9,11,13,15,17,19,20,22,24,26,27,29,31,33,34,36,38,39,41,42,44,45,47,48,50,51,53,54,55,56,58,59,60,61,62,63,64,65,66,67,68,69,70,70,71,72,72,73,73,74,74,75,75,75,76,76,76,76,76,76,76,76,76,76,76,75,75,75,74,74,73,73,72,72,71,70,70,69,68,67,66,65,64,63,62,61,60,59,58,56,55,54,53,51,50,48,47,45,44,42,41,39,38,36,34,33,31,29,27,26,24,22,20,19,17,15,13,11,9,7,6,4,2,0,-2,-4,-6,-7,-9,-11,-13,-15,-17,-19,-20,-22,-24,-26,-27,-29,-31,-33,-34,-36,-38,-39,-41,-42,-44,-45,-47,-48,-50,-51,-53,-54,-55,-56,-58,-59,-60,-61,-62,-63,-64,-65,-66,-67,-68,-69,-70,-70,-71,-72,-72,-73,-73,-74,-74,-75,-75,-75,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-76,-75,-75,-75,-74,-74,-73,-73,-72,-72,-71,-70,-70,-69,-68,-67,-66,-65,-64,-63,-62,-61,-60,-59,-58,-56,-55,-54,-53,-51,-50,-48,-47,-45,-44,-42,-41,-39,-38,-36,-34,-33,-31,-29,-27,-26,-24,-22,-20,-19,-17,-15,-13,-11,-9,-7,-6,-4,-2,0,2,4,6,8,10,12,14,17,19,21,23,25,27,29,30,32,34,36,38,40,42,44,45,47,49,50,52,54,55,57,58,60,61,63,64,65,67,68,69,70,72,73,74,75,76,77,77,78,79,80,80,81,82,82,83,83,83,84,84,84,84,85,85,85,85,85,84,84,84,84,83,83,83,82,82,81,80,80,79,78,77,77,76,75,74,73,72,70,69,68,67,65,64,63,61,60,58,57,55,54,52,50,49,47,45,44,42,40,38,36,34,32,30,29,27,25,23,21,19,17,14,12,10,8,6,4,2,0,-2,-4,-6,-8,-10,-12,-14,-17,-19,-21,-23,-25,-27,-29,-30,-32,-34,-36,-38,-40,-42,-44,-45,-47,-49,-50,-52,-54,-55,-57,-58,-60,-61,-63,-64,-65,-67,-68,-69,-70,-72,-73,-74,-75,-76,-77,-77,-78,-79,-80,-80,-81,-82,-82,-83,-83,-83,-84,-84,-84,-84,-85,-85,-85,-85,-85,-84,-84,-84,-84,-83,-83,-83,-82,-82,-81,-80,-80,-79,-78,-77,-77,-76,-75,-74,-73,-72,-70,-69,-68,-67,-65,-64,-63,-61,-60,-58,-57,-55,-54,-52,-50,-49,-47,-45,-44,-42,-40,-38,-36,-34,-32,-30,-29,-27,-25,-23,-21,-19,-17,-14,-12,-10,-8,-6,-4,-2,0,2,5,7,9,11,14,16,18,20,23,25,27,29,31,34,36,38,40,42,44,46,48,50,52,54,55,57,59,61,63,64,66,67,69,71,72,73,75,76,77,79,80,81,82,83,84,85,86,87,88,88,89,90,90,91,91,92,92,92,93,93,93,93,93,93,93,93,93,92,92,92,91,91,90,90,89,88,88,87,86,85,84,83,82,81,80,79,77,76,75,73,72,71,69,67,66,64,63,61,59,57,55,54,52,50,48,46,44,42,40,38,36,34,31,29,27,25,23,20,18,16,14,11,9,7,5,2,0,-2,-5,-7,-9,-11,-14,-16,-18,-20,-23,-25,-27,-29,-31,-34,-36,-38,-40,-42,-44,-46,-48,-50,-52,-54,-55,-57,-59,-61,-63,-64,-66,-67,-69,-71,-72,-73,-75,-76,-77,-79,-80,-81,-82,-83,-84,-85,-86,-87,-88,-88,-89,-90,-90,-91,-91,-92,-92,-92,-93,-93,-93,-93,-93,-93,-93,-93,-93,-92,-92,-92,-91,-91,-90,-90,-89,-88,-88,-87,-86,-85,-84,-83,-82,-81,-80,-79,-77,-76,-75,-73,-72,-71,-69,-67,-66,-64,-63,-61,-59,-57,-55,-54,-52,-50,-48,-46,-44,-42,-40,-38,-36,-34,-31,-29,-27,-25,-23,-20,-18,-16,-14,-11,-9,-7,-5,-2,0,2,5,7,10,12,15,17,20,22,25,27,29,32,34,37,39,41,43,46,48,50,52,54,56,59,61,63,64,66,68,70,72,74,75,77,79,80,82,83,84,86,87,88,90,91,92,93,94,95,96,96,97,98,99,99,100,100,101,101,101,101,101,102,102,102,101,101,101,101,101,100,100,99,99,98,97,96,96,95,94,93,92,91,90,88,87,86,84,83,82,80,79,77,75,74,72,70,68,66,64,63,61,59,56,54,52,50,48,46,43,41,39,37,34,32,29,27,25,22,20,17,15,12,10,7,5,2,0,-2,-5,-7,-10,-12,-15,-17,-20,-22,-25,-27,-29,-32,-34,-37,-39,-41,-43,-46,-48,-50,-52,-54,-56,-59,-61,-63,-64,-66,-68,-70,-72,-74,-75,-77,-79,-80,-82,-83,-84,-86,-87,-88,-90,-91,-92,-93,-94,-95,-96,-96,-97,-98,-99,-99,-100,-100,-101,-101,-101,-101,-101,-102,-102,-102,-101,-101,-101,-101,-101,-100,-100,-99,-99,-98,-97,-96,-96,-95,-94,-93,-92,-91,-90,-88,-87,-86,-84,-83,-82,-80,-79,-77,-75,-74,-72,-70,-68,-66,-64,-63,-61,-59,-56,-54,-52,-50,-48,-46,-43,-41,-39,-37,-34,-32,-29,-27,-25,-22,-20,-17,-15,-12,-10,-7,-5,-2,0,3,5,8,11,13,16,19,21,24,27,29,32,35,37,40,42,45,47,49,52,54,57,59,61,63,66,68,70,72,74,76,78,80,82,83,85,87,88,90,92,93,94,96,97,98,99,101,102,103,104,105,105,106,107,107,108,108,109,109,110,110,110,110,110,110,110,110,110,109,109,108,108,107,107,106,105,105,104,103,102,101,99,98,97,96,94,93,92,90,88,87,85,83,82,80,78,76,74,72,70,68,66,63,61,59,57,54,52,49,47,45,42,40,37,35,32,29,27,24,21,19,16,13,11,8,5,3,0,-3,-5,-8,-11,-13,-16,-19,-21,-24,-27,-29,-32,-35,-37,-40,-42,-45,-47,-49,-52,-54,-57,-59,-61,-63,-66,-68,-70,-72,-74,-76,-78,-80,-82,-83,-85,-87,-88,-90,-92,-93,-94,-96,-97,-98,-99,-101,-102,-103,-104,-105,-105,-106,-107,-107,-108,-108,-109,-109,-110,-110,-110,-110,-110,-110,-110,-110,-110,-109,-109,-108,-108,-107,-107,-106,-105,-105,-104,-103,-102,-101,-99,-98,-97,-96,-94,-93,-92,-90,-88,-87,-85,-83,-82,-80,-78,-76,-74,-72,-70,-68,-66,-63,-61,-59,-57,-54,-52,-49,-47,-45,-42,-40,-37,-35,-32,-29,-27,-24,-21,-19,-16,-13,-11,-8,-5,-3,0,3,6,9,12,15,17,20,23,26,29,32,34,37,40,43,45,48,51,53,56,58,61,63,66,68,71,73,75,77,80,82,84,86,88,90,92,93,95,97,99,100,102,103,105,106,107,108,110,111,112,113,113,114,115,116,116,117,117,118,118,118,118,118,119,118,118,118,118,118,117,117,116,116,115,114,113,113,112,111,110,108,107,106,105,103,102,100,99,97,95,93,92,90,88,86,84,82,80,77,75,73,71,68,66,63,61,58,56,53,51,48,45,43,40,37,34,32,29,26,23,20,17,15,12,9,6,3,0,-3,-6,-9,-12,-15,-17,-20,-23,-26,-29,-32,-34,-37,-40,-43,-45,-48,-51,-53,-56,-58,-61,-63,-66,-68,-71,-73,-75,-77,-80,-82,-84,-86,-88,-90,-92,-93,-95,-97,-99,-100,-102,-103,-105,-106,-107,-108,-110,-111,-112,-113,-113,-114,-115,-116,-116,-117,-117,-118,-118,-118,-118,-118,-119,-118,-118,-118,-118,-118,-117,-117,-116,-116,-115,-114,-113,-113,-112,-111,-110,-108,-107,-106,-105,-103,-102,-100,-99,-97,-95,-93,-92,-90,-88,-86,-84,-82,-80,-77,-75,-73,-71,-68,-66,-63,-61,-58,-56,-53,-51,-48,-45,-43,-40,-37,-34,-32,-29,-26,-23,-20,-17,-15,-12,-9,-6,-3,0,3,6,9,12,16,19,22,25,28,31,34,37,40,43,46,49,51,54,57,60,63,65,68,71,73,76,78,81,83,85,88,90,92,94,96,98,100,102,104,106,107,109,111,112,113,115,116,117,118,120,121,122,122,123,124,125,125,126,126,126,127,127,127,127,127,127,127,126,126,126,125,125,124,123,122,122,121,120,118,117,116,115,113,112,111,109,107,106,104,102,100,98,96,94,92,90,88,85,83,81,78,76,73,71,68,65,63,60,57,54,51,49,46,43,40,37,34,31,28,25,22,19,16,12,9,6,3,0,-3,-6,-9,-12,-16,-19,-22,-25,-28,-31,-34,-37,-40,-43,-46,-49,-51,-54,-57,-60,-63,-65,-68,-71,-73,-76,-78,-81,-83,-85,-88,-90,-92,-94,-96,-98,-100,-102,-104,-106,-107,-109,-111,-112,-113,-115,-116,-117,-118,-120,-121,-122,-122,-123,-124,-125,-125,-126,-126,-126,-127,-127,-127,-127,-127,-127,-127,-126,-126,-126,-125,-125,-124,-123,-122,-122,-121,-120,-118,-117,-116,-115,-113,-112,-111,-109,-107,-106,-104,-102,-100,-98,-96,-94,-92,-90,-88,-85,-83,-81,-78,-76,-73,-71,-68,-65,-63,-60,-57,-54,-51,-49,-46,-43,-40,-37,-34,-31,-28,-25,-22,-19,-16,-12,-9,-6,-3,0 };
+// Sums of squares in 4 lanes by sample position in the update interval,
+// vectorizable and independent of how blocks are split
+static void accumulate_squares(float* s, int pos, const float* x, int n_samples) {
+	int i = 0;
+	for (; i < n_samples && ((pos + i) & 3); i++)
+		s[(pos + i) & 3] += x[i] * x[i];
+	for (; i + 4 <= n_samples; i += 4) {
+		s[0] += x[i] * x[i];
+		s[1] += x[i + 1] * x[i + 1];
+		s[2] += x[i + 2] * x[i + 2];
+		s[3] += x[i + 3] * x[i + 3];
+	}
+	for (; i < n_samples; i++)
+		s[(pos + i) & 3] += x[i] * x[i];
+}
 
-void asid_process(asid instance, const float** x, float** y, int n_samples) {
+// Also with -ffast-math, which lets compilers assume there are no NaNs and
+// infinities
+static inline char is_finite(float x) {
+	ormath_floatint v = {.f = x};
+	return (v.i & 0x7f800000) != 0x7f800000;
+}
+
+// ormath_clipf() overflows for values near FLT_MAX, host values can be anything
+static inline float clamp(float x, float min, float max) {
+	return x < min ? min : (x > max ? max : x);
+}
+
+// At the internal rate
+static void process_internal(asid instance, const float* x, float* y, int n_samples) {
 	int i = 0;
 	while (i < n_samples) {
 		if (instance->update_left == 0) {
@@ -97,15 +294,36 @@ void asid_process(asid instance, const float** x, float** y, int n_samples) {
 
 			instance->lfo_phase += lfo_increments[lfo_speed]; // automatic wrap by overflow
 
-			signed char lfo = lfo_map[(((unsigned int)lfo_amount) << 8) + instance->lfo_phase];
+			// Envelope follower on the RMS of the previous update interval,
+			// full scale cutoff offset (amount * 17) at RMS >= 0.5
+			int env_offset = 0;
+			if (instance->env_count > 0) {
+				const unsigned char env_amount = (unsigned char)ormath_minf(ormath_floorf(16.f * instance->params[p_env_amount]), 15.f);
+				const unsigned char env_attack = (unsigned char)ormath_minf(ormath_floorf(16.f * instance->params[p_env_attack]), 15.f);
+				const unsigned char env_release = (unsigned char)ormath_minf(ormath_floorf(16.f * instance->params[p_env_release]), 15.f);
+				const float sum = (instance->env_sum[0] + instance->env_sum[1]) + (instance->env_sum[2] + instance->env_sum[3]);
+				const float level = sqrtf(sum / (float)instance->env_count);
+				const float k = level > instance->env ? env_attack_coeffs[env_attack] : env_release_coeffs[env_release];
+				instance->env += k * (level - instance->env);
+				env_offset = (int)ormath_roundf((float)(17 * env_amount) * ormath_minf(2.f * instance->env, 1.f));
+				for (int j = 0; j < 4; j++)
+					instance->env_sum[j] = 0.f;
+				instance->env_count = 0;
+			}
 
 			cutoff = (cutoff << 4) | 8;
-			int c = cutoff + lfo;
-			cutoff = c > 255 ? 255 : (c < 0 ? 0 : c);
+			for (int s = 0; s < instance->n_stages; s++) {
+				const unsigned char phase = instance->lfo_phase + instance->stage_lfo_offset[s]; // wraps as well
+				signed char lfo = lfo_map[(((unsigned int)lfo_amount) << 8) + phase];
+
+				int c = cutoff + env_offset + instance->stage_cutoff_offset[s] + lfo;
+				c = c > 255 ? 255 : (c < 0 ? 0 : c);
 
-			instance->modulated_cutoff = (1.f / 255.f) * cutoff;
+				if (s == 0)
+					instance->modulated_cutoff = (1.f / 255.f) * c;
 
-			ordsp_mos_8580_filter_set_cutoff(instance->filter, (1.f / 2047.f) * cutoff_map[cutoff]);
+				instance->kernel->set_cutoff(instance->stages[s], (1.f / 2047.f) * instance->kernel->cutoff_map[c]);
+			}
 
 			instance->update_left = instance->update_samples;
 		}
@@ -113,17 +331,146 @@ void asid_process(asid instance, const float** x, float** y, int n_samples) {
 		int n = instance->update_left < (n_samples - i) ? instance->update_left : n_samples - i;
 		instance->update_left -= n;
 
-		ordsp_mos_8580_filter_process(instance->filter, x[0] + i, y[0] + i, n);
+		accumulate_squares(instance->env_sum, instance->env_count, x + i, n);
+		instance->env_count += n;
+
+		// later stages in place, the block is still in cache
+		instance->kernel->process(instance->stages[0], x + i, y + i, n);
+		for (int s = 1; s < instance->n_stages; s++)
+			instance->kernel->process(instance->stages[s], y + i, y + i, n);
 
 		i += n;
 	}
 }
 
+void asid_process(asid instance, const float** x, float** y, int n_samples) {
+	if (instance->decimation_stages == 0) {
+		process_internal(instance, x[0], y[0], n_samples);
+		return;
+	}
+
+	// input block is fully read before the output block is written, x == y is fine
+	ordsp_halfband inner = instance->halfbands[0];
+	ordsp_halfband outer = instance->halfbands[1];
+	for (int i = 0; i < n_samples; i += DECIMATION_BLOCK) {
+		const int n = n_samples - i < DECIMATION_BLOCK ? n_samples - i : DECIMATION_BLOCK;
+		if (instance->decimation_stages == 1) {
+			const int n2 = ordsp_halfband_decimate(inner, x[0] + i, instance->buf_2x, n);
+			process_internal(instance, instance->buf_2x, instance->buf_2x, n2);
+			ordsp_halfband_interpolate(inner, instance->buf_2x, y[0] + i, n);
+		} else {
+			const int n2 = ordsp_halfband_decimate(outer, x[0] + i, instance->buf_2x, n);
+			const int n4 = ordsp_halfband_decimate(inner, instance->buf_2x, instance->buf_4x, n2);
+			process_internal(instance, instance->buf_4x, instance->buf_4x, n4);
+			ordsp_halfband_interpolate(inner, instance->buf_4x, instance->buf_2x, n2);
+			ordsp_halfband_interpolate(outer, instance->buf_2x, y[0] + i, n);
+		}
+	}
+}
+
+// Values from hosts, states, and bindings are not trusted
 void asid_set_parameter(asid instance, int index, float value) {
-	if (index < 3)
-		instance->params[index] = value;
+	if (index < 0 || index >= p_n || index == p_modulated_cutoff || !is_finite(value))
+		return;
+	instance->params[index] = clamp(value, 0.f, 1.f);
 }
 
 float asid_get_parameter(asid instance, int index) {
-	return index == 3 ? instance->modulated_cutoff : instance->params[index];
+	if (index < 0 || index >= p_n)
+		return 0.f;
+	return index == p_modulated_cutoff ? instance->modulated_cutoff : instance->params[index];
+}
+
+void asid_set_quality(asid instance, asid_quality value) {
+	for (int m = 0; m < asid_model_n; m++)
+		for (int s = 0; s < ASID_STAGES_MAX; s++)
+			kernels[m].set_quality(instance->filters[m][s], value);
+}
+
+void asid_set_model(asid instance, asid_model value) {
+	if (instance->model == value)
+		return;
+	instance->model = value;
+	instance->kernel = kernels + value;
+	instance->stages = instance->filters[value];
+	for (int s = 0; s < instance->n_stages; s++)
+		instance->kernel->reset(instance->stages[s]);
+	instance->update_left = 0;
+}
+
+void asid_set_stages(asid instance, int value) {
+	value = ormath_clipi32(value, 1, ASID_STAGES_MAX);
+	for (int s = instance->n_stages; s < value; s++)
+		instance->kernel->reset(instance->stages[s]);
+	instance->n_stages = value;
+	instance->update_left = 0;
+}
+
+void asid_set_stage_cutoff_offset(asid instance, int stage, float value) {
+	if (stage < 0 || stage >= ASID_STAGES_MAX || !is_finite(value))
+		return;
+	instance->stage_cutoff_offset[stage] = (int)ormath_roundf(255.f * clamp(value, -1.f, 1.f));
+}
+
+void asid_set_stage_lfo_offset(asid instance, int stage, float value) {
+	if (stage < 0 || stage >= ASID_STAGES_MAX || !is_finite(value))
+		return;
+	value -= ormath_floorf(value);
+	instance->stage_lfo_offset[stage] = (unsigned char)((int)ormath_floorf(256.f * value) & 0xff);
+}
+
+void asid_set_stage_mode(asid instance, int stage, float lp, float bp, float hp) {
+	if (stage < 0 || stage >= ASID_STAGES_MAX || !is_finite(lp) || !is_finite(bp) || !is_finite(hp))
+		return;
+	lp = clamp(lp, 0.f, 1.f);
+	bp = clamp(bp, 0.f, 1.f);
+	hp = clamp(hp, 0.f, 1.f);
+	for (int m = 0; m < asid_model_n; m++)
+		kernels[m].set_mode(instance->filters[m][stage], 0.f, lp, bp, hp);
+}
+
+void asid_set_stage_volume(asid instance, int stage, float value) {
+	if (stage < 0 || stage >= ASID_STAGES_MAX || !is_finite(value))
+		return;
+	value = clamp(value, 0.f, 1.f);
+	for (int m = 0; m < asid_model_n; m++)
+		kernels[m].set_volume(instance->filters[m][stage], value);
+}
+
+void asid_set_decimation(asid instance, char value) {
+	instance->decimation = value;
+	update_rate(instance);
+	asid_reset(instance);
+}
+
+int asid_get_latency(asid instance) {
+	if (instance->decimation_stages == 0)
+		return 0;
+	int l = ordsp_halfband_get_latency(instance->halfbands[0]);
+	if (instance->decimation_stages == 2)
+		l = 2 * l + ordsp_halfband_get_latency(instance->halfbands[1]);
+	return l;
+}
+
+// Only the filters of the calibrated model get the curve, the others go back
+// to the built-in one. The cutoff knob keeps mapping to the same register
+// values, as the original program would on a different chip.
+char asid_set_calibration(asid instance, const char* path) {
+	ordsp_mos_calibration c = NULL;
+	if (path != NULL) {
+		c = ordsp_mos_calibration_open(path);
+		if (c == NULL)
+			return 0;
+	}
+
+	const int model = c != NULL ? (int)ordsp_mos_calibration_get_model(c) : -1;
+	const float *curve = c != NULL ? ordsp_mos_calibration_get_cutoff_curve(c) : NULL;
+	for (int m = 0; m < asid_model_n; m++)
+		for (int s = 0; s < ASID_STAGES_MAX; s++)
+			kernels[m].set_cutoff_curve(instance->filters[m][s], m == model ? curve : NULL);
+
+	if (instance->calibration != NULL)
+		ordsp_mos_calibration_close(instance->calibration);
+	instance->calibration = c;
+	return 1;
 }
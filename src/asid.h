@@ -20,19 +20,67 @@
 #ifndef _ASID_H
 #define _ASID_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef struct _asid* asid;
 
+#define ASID_STAGES_MAX		4
+
+typedef enum {
+	asid_quality_fast,		// Padé tan, state space linear filter, single Newton step, output buffer table (VST3 realtime)
+	asid_quality_balanced,		// default
+	asid_quality_reference		// exact math, for offline rendering
+} asid_quality;
+
+typedef enum {
+	asid_model_8580,		// default
+	asid_model_6581,
+	asid_model_n
+} asid_model;
+
 asid asid_new();
 void asid_free(asid instance);
+// Same with all memory from the caller (e.g., plugin hosts): asid_mem_req()
+// bytes, 16-byte aligned, then asid_fini() instead of asid_free(). Nothing
+// else allocates memory, other than asid_set_calibration().
+size_t asid_mem_req();
+asid asid_new_in(void* mem);
+void asid_fini(asid instance);
 void asid_set_sample_rate(asid instance, float sample_rate);
 void asid_reset(asid instance);
 void asid_process(asid instance, const float** x, float** y, int n_samples);
+// Parameters, values in [0, 1]: 0 = cutoff, 1 = LFO amount, 2 = LFO speed,
+// 3 = modulated cutoff (output, get only), 4 = envelope follower amount,
+// 5 = envelope attack, 6 = envelope release
 void asid_set_parameter(asid instance, int index, float value);
 float asid_get_parameter(asid instance, int index);
+void asid_set_quality(asid instance, asid_quality value);
+void asid_set_model(asid instance, asid_model value);		// resets the filter state
+
+// Serial chain of filters (e.g., dual SID), each stage gets the cutoff and LFO
+// of the parameters plus its own offsets. Stage 0 is the one reported as
+// modulated cutoff. Defaults: 1 stage, no offsets, bandpass, volume 1.
+void asid_set_stages(asid instance, int value);						// value in [1, ASID_STAGES_MAX]
+void asid_set_stage_cutoff_offset(asid instance, int stage, float value);		// value in [-1, 1], relative to the cutoff parameter range
+void asid_set_stage_lfo_offset(asid instance, int stage, float value);		// value in [0, 1), fraction of LFO cycle
+void asid_set_stage_mode(asid instance, int stage, float lp, float bp, float hp);	// values 0, 1 correspond to originals (either 0 or 1)
+void asid_set_stage_volume(asid instance, int stage, float value);			// value in [0, 1], corresponds to original range [0, 15]
+
+// Decimation: at host sample rates >= 88.2 kHz, runs the filters at 1/2 or 1/4
+// of that (never below 44.1 kHz), with halfband resampling around them (flat
+// up to 0.408 times the internal rate, i.e., >= 18 kHz) and added latency.
+// Off by default.
+void asid_set_decimation(asid instance, char value);	// resets the state
+int asid_get_latency(asid instance);			// in samples at the host rate, depends on sample rate and decimation
+
+// Per-chip cutoff curve from a calibration file (see mos_calibration.h), for
+// the model the file is for. Files are shared read-only across instances.
+// NULL goes back to the built-in curves. Not realtime-safe.
+char asid_set_calibration(asid instance, const char* path);	// returns 0 (and keeps the current curve) if the file cannot be loaded
 
 #ifdef __cplusplus
 }
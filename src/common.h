@@ -35,4 +35,30 @@
 # define ORDSP_FREE free
 #endif
 
+// Process-wide one-time initialization: the first caller runs init() and the
+// others wait for it to finish. *state must be a zero-initialized static.
+// Not realtime-safe, call when creating instances.
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# include <intrin.h>
+# define ORDSP_CAS(p, o, n)	(_InterlockedCompareExchange((volatile long *)(p), (n), (o)) == (o))
+# define ORDSP_LOAD_ACQ(p)	(*(p))
+# define ORDSP_STORE_REL(p, v)	(*(p) = (v))
+#else
+# define ORDSP_CAS(p, o, n)	__sync_bool_compare_and_swap((p), (o), (n))
+# define ORDSP_LOAD_ACQ(p)	__atomic_load_n((p), __ATOMIC_ACQUIRE)
+# define ORDSP_STORE_REL(p, v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+static inline void ordsp_once(volatile long *state, void (*init)(void)) {
+	if (ORDSP_LOAD_ACQ(state) == 2)
+		return;
+	if (ORDSP_CAS(state, 0, 1)) {
+		init();
+		ORDSP_STORE_REL(state, 2);
+	} else
+		while (ORDSP_LOAD_ACQ(state) != 2)
+			;
+}
+
 #endif
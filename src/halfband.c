@@ -0,0 +1,220 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#include "halfband.h"
+
+#include "common.h"
+
+#if (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)) && !defined(ORDSP_NO_SIMD)
+# include <xmmintrin.h>
+# define HB_SSE
+#endif
+
+// Only the odd polyphase branch (2 * K taps, symmetric) is stored, the other
+// one is a pure delay of K - 1 samples at the lower rate with gain 0.5.
+
+static const float coeffs_sharp[32] = {
+	-1.031712974e-05f, 6.058169217e-05f, -1.852038563e-04f, 4.409557854e-04f,
+	-9.073802543e-04f, 1.690073652e-03f, -2.924402346e-03f, 4.781806048e-03f,
+	-7.483537557e-03f, 1.133258098e-02f, -1.678933169e-02f, 2.466040852e-02f,
+	-3.662577557e-02f, 5.704599962e-02f, -1.020092530e-01f, 3.169227951e-01f,
+	3.169227951e-01f, -1.020092530e-01f, 5.704599962e-02f, -3.662577557e-02f,
+	2.466040852e-02f, -1.678933169e-02f, 1.133258098e-02f, -7.483537557e-03f,
+	4.781806048e-03f, -2.924402346e-03f, 1.690073652e-03f, -9.073802543e-04f,
+	4.409557854e-04f, -1.852038563e-04f, 6.058169217e-05f, -1.031712974e-05f
+};
+
+static const float coeffs_relaxed[12] = {
+	-7.729994854e-06f, 5.916551222e-04f, -4.934769325e-03f, 2.192403465e-02f,
+	-7.324578236e-02f, 3.056725919e-01f, 3.056725919e-01f, -7.324578236e-02f,
+	2.192403465e-02f, -4.934769325e-03f, 5.916551222e-04f, -7.729994854e-06f
+};
+
+#define TAPS_MAX	32
+#define CHUNK		64	// samples at the lower rate, multiple of 4
+
+struct _ordsp_halfband {
+	// Coefficients
+	const float	*c;
+	int		 n;			// 2 * K, multiple of 4
+	int		 k;
+
+	// States
+	float		 x_odd[TAPS_MAX - 1 + CHUNK];	// n - 1 past values, then the current chunk
+	float		 x_even[TAPS_MAX / 2];		// circular
+	float		 u[TAPS_MAX - 1 + CHUNK];	// as x_odd
+	int		 x_even_pos;
+	char		 phase;
+	char		 block_phase;
+	float		 pending;
+
+	// Buffers
+	float		 center[CHUNK];
+	float		 a[CHUNK];
+};
+
+size_t ordsp_halfband_mem_req() {
+	return sizeof(struct _ordsp_halfband);
+}
+
+ordsp_halfband ordsp_halfband_new(ordsp_halfband_response response) {
+	void *mem = ORDSP_MALLOC(ordsp_halfband_mem_req());
+	return mem != NULL ? ordsp_halfband_new_in(mem, response) : NULL;
+}
+
+ordsp_halfband ordsp_halfband_new_in(void* mem, ordsp_halfband_response response) {
+	ordsp_halfband instance = (ordsp_halfband)mem;
+	if (response == ordsp_halfband_relaxed) {
+		instance->c = coeffs_relaxed;
+		instance->n = sizeof(coeffs_relaxed) / sizeof(float);
+	} else {
+		instance->c = coeffs_sharp;
+		instance->n = sizeof(coeffs_sharp) / sizeof(float);
+	}
+	instance->k = instance->n >> 1;
+	ordsp_halfband_reset(instance);
+	return instance;
+}
+
+void ordsp_halfband_free(ordsp_halfband instance) {
+	ORDSP_FREE(instance);
+}
+
+void ordsp_halfband_reset(ordsp_halfband instance) {
+	for (int i = 0; i < TAPS_MAX - 1 + CHUNK; i++) {
+		instance->x_odd[i] = 0.f;
+		instance->u[i] = 0.f;
+	}
+	for (int i = 0; i < TAPS_MAX / 2; i++)
+		instance->x_even[i] = 0.f;
+	instance->x_even_pos = 0;
+	instance->phase = 0;
+	instance->block_phase = 0;
+	instance->pending = 0.f;
+}
+
+// y[i] = sum_j c[j] * x[i + j], j in [0, n), i in [0, m), using symmetry.
+// Vectorized over i, so that there are no horizontal sums and the
+// accumulations are independent.
+static void fir(const float* c, int n, const float* x, float* y, int m) {
+	const int k = n >> 1;
+	int i = 0;
+#ifdef HB_SSE
+	for (; i + 4 <= m; i += 4) {
+		__m128 a0 = _mm_setzero_ps();
+		__m128 a1 = _mm_setzero_ps();
+		for (int j = 0; j < k; j += 2) {
+			a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_set1_ps(c[j]), _mm_add_ps(_mm_loadu_ps(x + i + j), _mm_loadu_ps(x + i + n - 1 - j))));
+			a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_set1_ps(c[j + 1]), _mm_add_ps(_mm_loadu_ps(x + i + j + 1), _mm_loadu_ps(x + i + n - 2 - j))));
+		}
+		_mm_storeu_ps(y + i, _mm_add_ps(a0, a1));
+	}
+#endif
+	// same operations in the same order as the vector lanes, so that the
+	// output does not depend on block sizes
+	for (; i < m; i++) {
+		float a0 = 0.f;
+		float a1 = 0.f;
+		for (int j = 0; j < k; j += 2) {
+			a0 += c[j] * (x[i + j] + x[i + n - 1 - j]);
+			a1 += c[j + 1] * (x[i + j + 1] + x[i + n - 2 - j]);
+		}
+		y[i] = a0 + a1;
+	}
+}
+
+static void shift(float* x, int n, int m) {
+	for (int i = 0; i < n - 1; i++)
+		x[i] = x[i + m];
+}
+
+// Samples at odd positions produce an output, the polyphase branch delay line
+// is gathered first and filtered per chunk.
+int ordsp_halfband_decimate(ordsp_halfband instance, const float* x, float* y, int n_samples) {
+	const int n = instance->n;
+	const int k = instance->k;
+	int m = 0;
+	int j = 0;
+	instance->block_phase = instance->phase;
+	for (int i = 0; i < n_samples; i++) {
+		if (instance->phase) {
+			instance->x_odd[n - 1 + m] = x[i];
+			const int e = instance->x_even_pos + 1 == k ? 0 : instance->x_even_pos + 1;
+			instance->center[m] = 0.5f * instance->x_even[e];
+			m++;
+			if (m == CHUNK) {
+				fir(instance->c, n, instance->x_odd, y + j, m);
+				for (int q = 0; q < m; q++)
+					y[j + q] += instance->center[q];
+				shift(instance->x_odd, n, m);
+				j += m;
+				m = 0;
+			}
+		} else {
+			instance->x_even_pos = instance->x_even_pos + 1 == k ? 0 : instance->x_even_pos + 1;
+			instance->x_even[instance->x_even_pos] = x[i];
+		}
+		instance->phase ^= 1;
+	}
+	if (m != 0) {
+		fir(instance->c, n, instance->x_odd, y + j, m);
+		for (int q = 0; q < m; q++)
+			y[j + q] += instance->center[q];
+		shift(instance->x_odd, n, m);
+		j += m;
+	}
+	return j;
+}
+
+// Each input sample gives 2 output samples, the second of which is output at
+// the next position.
+void ordsp_halfband_interpolate(ordsp_halfband instance, const float* x, float* y, int n_samples) {
+	const int n = instance->n;
+	const int k = instance->k;
+	char phase = instance->block_phase;
+	int m = 0;	// in chunk
+	int l = 0;	// chunk length
+	int j = 0;	// consumed input
+	int m_tot = (n_samples + phase) >> 1;
+	for (int i = 0; i < n_samples; i++) {
+		if (phase) {
+			if (m == l) {
+				if (l != 0)
+					shift(instance->u, n, l);
+				l = m_tot - j < CHUNK ? m_tot - j : CHUNK;
+				for (int q = 0; q < l; q++)
+					instance->u[n - 1 + q] = 2.f * x[j + q];
+				fir(instance->c, n, instance->u, instance->a, l);
+				j += l;
+				m = 0;
+			}
+			y[i] = instance->a[m];
+			instance->pending = 0.5f * instance->u[k + m];
+			m++;
+		} else
+			y[i] = instance->pending;
+		phase ^= 1;
+	}
+	if (l != 0)
+		shift(instance->u, n, l);
+}
+
+int ordsp_halfband_get_latency(ordsp_halfband instance) {
+	return 2 * instance->n - 2;
+}
@@ -0,0 +1,65 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Halfband FIR lowpass for 2x polyphase decimation and interpolation. Linear
+// phase, Kaiser-windowed sinc, designed for a passband up to 0.408 times the
+// lower rate, the upper rate being 2x or 4x that:
+//
+//   ordsp_halfband_sharp: 63 taps, for 2x, passband [0, 0.204] of the upper
+//                         rate, ripple < 0.001 dB, stopband rejection > 88 dB;
+//   ordsp_halfband_relaxed: 23 taps, for the outer stage of 4x, passband
+//                           [0, 0.102] of the upper rate, ripple < 0.001 dB,
+//                           stopband rejection > 97 dB.
+//
+// i.e., flat up to 18 kHz at 44.1 kHz and up to 19.6 kHz at 48 kHz.
+//
+// Decimation and interpolation share the instance and are meant to be called
+// on the same blocks, in the same order: the whole round trip delays the
+// signal by an integer number of samples (see get_latency()), any block size.
+
+#ifndef _ORDSP_HALFBAND_H
+#define _ORDSP_HALFBAND_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _ordsp_halfband* ordsp_halfband;
+
+typedef enum {
+	ordsp_halfband_sharp,
+	ordsp_halfband_relaxed
+} ordsp_halfband_response;
+
+ordsp_halfband ordsp_halfband_new(ordsp_halfband_response response);
+size_t ordsp_halfband_mem_req();
+ordsp_halfband ordsp_halfband_new_in(void* mem, ordsp_halfband_response response);	// in mem_req() bytes of caller memory, 16-byte aligned, no free() needed
+void ordsp_halfband_free(ordsp_halfband instance);
+void ordsp_halfband_reset(ordsp_halfband instance);
+int ordsp_halfband_decimate(ordsp_halfband instance, const float* x, float* y, int n_samples);	// returns number of output samples, at most (n_samples + 1) / 2
+void ordsp_halfband_interpolate(ordsp_halfband instance, const float* x, float* y, int n_samples);	// n_samples and x as in and from the last decimate() call
+int ordsp_halfband_get_latency(ordsp_halfband instance);						// round trip, in samples at the upper rate
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#include "mos_6581_filter.h"
+
+#include "common.h"
+#include "mos_filter.h"
+
+// Same structure and gain as the 8580 model, all in mos_filter.c, but for the
+// cutoff curve and the resonance law
+
+// Cutoff frequency (Hz) vs register value, average 6581R3 curve after the
+// one in reSID by Dag Lem. It is split in two at 1023/1024, where bit 10 flips
+// and the frequency drops. Each half is interpolated with a monotone cubic
+// (Fritsch-Carlson) into freq_table, once per process.
+
+typedef struct {
+	float x;
+	float f;
+} curve_point;
+
+static const curve_point curve_low[] = {
+	{ 0.f, 220.f }, { 128.f, 230.f }, { 256.f, 250.f }, { 384.f, 300.f }, { 512.f, 420.f }, { 640.f, 780.f }, { 768.f, 1600.f },
+	{ 832.f, 2300.f }, { 896.f, 3200.f }, { 960.f, 4300.f }, { 992.f, 5000.f }, { 1008.f, 5400.f }, { 1016.f, 5700.f }, { 1023.f, 6000.f }
+};
+static const curve_point curve_high[] = {
+	{ 1024.f, 4600.f }, { 1032.f, 4800.f }, { 1056.f, 5300.f }, { 1088.f, 6000.f }, { 1120.f, 6600.f }, { 1152.f, 7200.f }, { 1280.f, 9500.f },
+	{ 1408.f, 12000.f }, { 1536.f, 14500.f }, { 1664.f, 16000.f }, { 1792.f, 17100.f }, { 1920.f, 17700.f }, { 2047.f, 18000.f }
+};
+
+#define CURVE_MAX_POINTS	16
+
+static float freq_table[2048];
+static volatile long freq_table_state;
+
+static void curve_fill(const curve_point* p, int n) {
+	float d[CURVE_MAX_POINTS];
+	float m[CURVE_MAX_POINTS];
+	for (int i = 0; i < n - 1; i++)
+		d[i] = (p[i + 1].f - p[i].f) / (p[i + 1].x - p[i].x);
+	m[0] = d[0];
+	m[n - 1] = d[n - 2];
+	for (int i = 1; i < n - 1; i++)
+		m[i] = d[i - 1] * d[i] <= 0.f ? 0.f : 0.5f * (d[i - 1] + d[i]);
+	for (int i = 0; i < n - 1; i++) {
+		if (d[i] == 0.f) {
+			m[i] = m[i + 1] = 0.f;
+			continue;
+		}
+		const float a = m[i] / d[i];
+		const float b = m[i + 1] / d[i];
+		const float s = a * a + b * b;
+		if (s > 9.f) {
+			const float t = 3.f / (float)sqrt(s);
+			m[i] = t * a * d[i];
+			m[i + 1] = t * b * d[i];
+		}
+	}
+	for (int i = 0; i < n - 1; i++) {
+		const float h = p[i + 1].x - p[i].x;
+		for (int x = (int)p[i].x; x <= (int)p[i + 1].x; x++) {
+			const float t = ((float)x - p[i].x) / h;
+			const float t2 = t * t;
+			const float t3 = t2 * t;
+			freq_table[x] = (2.f * t3 - 3.f * t2 + 1.f) * p[i].f + (t3 - 2.f * t2 + t) * h * m[i]
+				+ (-2.f * t3 + 3.f * t2) * p[i + 1].f + (t3 - t2) * h * m[i + 1];
+		}
+	}
+}
+
+static void freq_table_init(void) {
+	curve_fill(curve_low, sizeof(curve_low) / sizeof(curve_point));
+	curve_fill(curve_high, sizeof(curve_high) / sizeof(curve_point));
+}
+
+static float cutoff_freq(float value) {
+	return ordsp_mos_filter_curve_lookup(freq_table, value);
+}
+
+// 1 / Q from 1 / 0.707 to 1 / 1.707
+static float resonance_k(float value) {
+	return -1.f / (0.7071067811865476f + value);
+}
+
+static const ordsp_mos_filter_model model = { cutoff_freq, resonance_k };
+
+size_t ordsp_mos_6581_filter_mem_req() {
+	return sizeof(struct _ordsp_mos_filter);
+}
+
+ordsp_mos_6581_filter ordsp_mos_6581_filter_new() {
+	void *mem = ORDSP_MALLOC(ordsp_mos_6581_filter_mem_req());
+	return mem != NULL ? ordsp_mos_6581_filter_new_in(mem) : NULL;
+}
+
+ordsp_mos_6581_filter ordsp_mos_6581_filter_new_in(void* mem) {
+	ordsp_once(&freq_table_state, freq_table_init);
+	ordsp_mos_filter_init((ordsp_mos_filter)mem, &model);
+	return (ordsp_mos_6581_filter)mem;
+}
+
+void ordsp_mos_6581_filter_free(ordsp_mos_6581_filter instance) {
+	ORDSP_FREE(instance);
+}
+
+void ordsp_mos_6581_filter_set_sample_rate(ordsp_mos_6581_filter instance, float sample_rate) {
+	ordsp_mos_filter_set_sample_rate((ordsp_mos_filter)instance, sample_rate);
+}
+
+void ordsp_mos_6581_filter_reset(ordsp_mos_6581_filter instance) {
+	ordsp_mos_filter_reset((ordsp_mos_filter)instance);
+}
+
+void ordsp_mos_6581_filter_process(ordsp_mos_6581_filter instance, const float* x, float* y, int n_samples) {
+	ordsp_mos_filter_process((ordsp_mos_filter)instance, x, y, n_samples);
+}
+
+void ordsp_mos_6581_filter_set_cutoff(ordsp_mos_6581_filter instance, float value) {
+	ordsp_mos_filter_set_cutoff((ordsp_mos_filter)instance, value);
+}
+
+void ordsp_mos_6581_filter_set_cutoff_curve(ordsp_mos_6581_filter instance, const float* value) {
+	ordsp_mos_filter_set_cutoff_curve((ordsp_mos_filter)instance, value);
+}
+
+void ordsp_mos_6581_filter_set_resonance(ordsp_mos_6581_filter instance, float value) {
+	ordsp_mos_filter_set_resonance((ordsp_mos_filter)instance, value);
+}
+
+void ordsp_mos_6581_filter_set_volume(ordsp_mos_6581_filter instance, float value) {
+	ordsp_mos_filter_set_volume((ordsp_mos_filter)instance, value);
+}
+
+void ordsp_mos_6581_filter_set_mode(ordsp_mos_6581_filter instance, float bypass, float lp, float bp, float hp) {
+	ordsp_mos_filter_set_mode((ordsp_mos_filter)instance, bypass, lp, bp, hp);
+}
+
+void ordsp_mos_6581_filter_set_quality(ordsp_mos_6581_filter instance, ordsp_mos_6581_filter_quality value) {
+	ordsp_mos_filter_set_quality((ordsp_mos_filter)instance, (ordsp_mos_filter_quality)value);
+}
+
+float ordsp_mos_6581_filter_get_cutoff_frequency(float value) {
+	ordsp_once(&freq_table_state, freq_table_init);
+	return cutoff_freq(value);
+}
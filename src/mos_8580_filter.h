@@ -20,21 +20,34 @@
 #ifndef _ORDSP_MOS_8580_FILTER_H
 #define _ORDSP_MOS_8580_FILTER_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef struct _ordsp_mos_8580_filter* ordsp_mos_8580_filter;
 
+typedef enum {
+	ordsp_mos_8580_filter_quality_fast,		// Padé tan, state space linear filter, single Newton step, output buffer table
+	ordsp_mos_8580_filter_quality_balanced,		// third order tan, output buffer table (default)
+	ordsp_mos_8580_filter_quality_reference		// libm + exact omega function, slow
+} ordsp_mos_8580_filter_quality;
+
 ordsp_mos_8580_filter ordsp_mos_8580_filter_new();
+size_t ordsp_mos_8580_filter_mem_req();
+ordsp_mos_8580_filter ordsp_mos_8580_filter_new_in(void* mem);	// in mem_req() bytes of caller memory, 16-byte aligned, no free() needed
 void ordsp_mos_8580_filter_free(ordsp_mos_8580_filter instance);
 void ordsp_mos_8580_filter_set_sample_rate(ordsp_mos_8580_filter instance, float sample_rate);
 void ordsp_mos_8580_filter_reset(ordsp_mos_8580_filter instance);
 void ordsp_mos_8580_filter_process(ordsp_mos_8580_filter instance, const float* x, float* y, int n_samples);
 void ordsp_mos_8580_filter_set_cutoff(ordsp_mos_8580_filter instance, float value);		// value in [0, 1], corresponds to original range [0, 2047]
+void ordsp_mos_8580_filter_set_cutoff_curve(ordsp_mos_8580_filter instance, const float* value);	// 2048 frequencies (Hz) for register values 0 to 2047, not copied, NULL for the built-in curve (default)
 void ordsp_mos_8580_filter_set_resonance(ordsp_mos_8580_filter instance, float value);	// value in [0, 1], corresponds to original range [0, 15]
 void ordsp_mos_8580_filter_set_volume(ordsp_mos_8580_filter instance, float value);		// value in [0, 1], corresponds to original range [0, 15]
 void ordsp_mos_8580_filter_set_mode(ordsp_mos_8580_filter instance, float bypass, float lp, float bp, float hp);	// values 0, 1 correspond to originals (either 0 or 1)
+void ordsp_mos_8580_filter_set_quality(ordsp_mos_8580_filter instance, ordsp_mos_8580_filter_quality value);
+void ordsp_mos_8580_filter_set_nonlinear(ordsp_mos_8580_filter instance, char value);	// saturating integrators, off by default, up to 8x slower (see tools/ormath_report)
 
 #ifdef __cplusplus
 }
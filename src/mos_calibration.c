@@ -0,0 +1,210 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#include "mos_calibration.h"
+
+#include "common.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <pthread.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#define HEADER_SIZE	16
+#define FILE_SIZE	(HEADER_SIZE + 4 * ORDSP_MOS_CALIBRATION_POINTS)
+
+struct _ordsp_mos_calibration {
+	uint64_t		 id[2];		// device and inode, or volume and file index
+	int			 refs;
+	const unsigned char	*data;
+	ordsp_mos_calibration	 next;
+#ifdef _WIN32
+	HANDLE			 file;
+	HANDLE			 mapping;
+#endif
+};
+
+// Process-wide list of open files, guarded by a mutex, as it is held while
+// mapping and validating (only touched when opening and closing). Files are
+// identified by what the path points to when opening, not by the path itself,
+// so that a file renamed over one in use gets its own mapping.
+
+static ordsp_mos_calibration open_files;
+
+#ifdef _WIN32
+static SRWLOCK lock = SRWLOCK_INIT;
+
+static void lock_acquire(void) {
+	AcquireSRWLockExclusive(&lock);
+}
+
+static void lock_release(void) {
+	ReleaseSRWLockExclusive(&lock);
+}
+#else
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void lock_acquire(void) {
+	pthread_mutex_lock(&lock);
+}
+
+static void lock_release(void) {
+	pthread_mutex_unlock(&lock);
+}
+#endif
+
+static unsigned int read_u32(const unsigned char* p) {
+	return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static char is_little_endian(void) {
+	const unsigned int x = 1;
+	return *(const unsigned char *)&x == 1;
+}
+
+static char data_valid(const unsigned char* data) {
+	if (memcmp(data, "ASCC", 4) != 0
+	    || read_u32(data + 4) != 1
+	    || read_u32(data + 8) > ordsp_mos_calibration_model_6581
+	    || read_u32(data + 12) != ORDSP_MOS_CALIBRATION_POINTS)
+		return 0;
+	const float *f = (const float *)(data + HEADER_SIZE);
+	for (int i = 0; i < ORDSP_MOS_CALIBRATION_POINTS; i++)
+		if (!(f[i] >= 0.f && f[i] < 1e6f) || (i > 0 && f[i] < f[i - 1]))
+			return 0;
+	return 1;
+}
+
+static char map(ordsp_mos_calibration instance, const char* path) {
+#ifdef _WIN32
+	instance->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (instance->file == INVALID_HANDLE_VALUE)
+		return 0;
+	BY_HANDLE_FILE_INFORMATION info;
+	if (!GetFileInformationByHandle(instance->file, &info)
+	    || info.nFileSizeHigh != 0 || info.nFileSizeLow != FILE_SIZE) {
+		CloseHandle(instance->file);
+		return 0;
+	}
+	instance->id[0] = info.dwVolumeSerialNumber;
+	instance->id[1] = ((uint64_t)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+	instance->mapping = CreateFileMappingA(instance->file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (instance->mapping == NULL) {
+		CloseHandle(instance->file);
+		return 0;
+	}
+	instance->data = (const unsigned char *)MapViewOfFile(instance->mapping, FILE_MAP_READ, 0, 0, 0);
+	if (instance->data == NULL) {
+		CloseHandle(instance->mapping);
+		CloseHandle(instance->file);
+		return 0;
+	}
+#else
+	const int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return 0;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size != FILE_SIZE) {
+		close(fd);
+		return 0;
+	}
+	instance->id[0] = (uint64_t)st.st_dev;
+	instance->id[1] = (uint64_t)st.st_ino;
+	void *p = mmap(NULL, FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED)
+		return 0;
+	instance->data = (const unsigned char *)p;
+#endif
+	return 1;
+}
+
+static void unmap(ordsp_mos_calibration instance) {
+#ifdef _WIN32
+	UnmapViewOfFile(instance->data);
+	CloseHandle(instance->mapping);
+	CloseHandle(instance->file);
+#else
+	munmap((void *)instance->data, FILE_SIZE);
+#endif
+}
+
+ordsp_mos_calibration ordsp_mos_calibration_open(const char* path) {
+	if (!is_little_endian())
+		return NULL;
+
+	ordsp_mos_calibration instance = (ordsp_mos_calibration)ORDSP_MALLOC(sizeof(struct _ordsp_mos_calibration));
+	if (instance == NULL)
+		return NULL;
+
+	lock_acquire();
+
+	if (map(instance, path)) {
+		for (ordsp_mos_calibration i = open_files; i != NULL; i = i->next)
+			if (i->id[0] == instance->id[0] && i->id[1] == instance->id[1]) {
+				i->refs++;
+				lock_release();
+				unmap(instance);
+				ORDSP_FREE(instance);
+				return i;
+			}
+		if (data_valid(instance->data)) {
+			instance->refs = 1;
+			instance->next = open_files;
+			open_files = instance;
+			lock_release();
+			return instance;
+		}
+		unmap(instance);
+	}
+
+	lock_release();
+	ORDSP_FREE(instance);
+	return NULL;
+}
+
+void ordsp_mos_calibration_close(ordsp_mos_calibration instance) {
+	lock_acquire();
+	instance->refs--;
+	if (instance->refs == 0) {
+		ordsp_mos_calibration *p = &open_files;
+		while (*p != instance)
+			p = &(*p)->next;
+		*p = instance->next;
+		unmap(instance);
+		ORDSP_FREE(instance);
+	}
+	lock_release();
+}
+
+ordsp_mos_calibration_model ordsp_mos_calibration_get_model(ordsp_mos_calibration instance) {
+	return (ordsp_mos_calibration_model)read_u32(instance->data + 8);
+}
+
+const float* ordsp_mos_calibration_get_cutoff_curve(ordsp_mos_calibration instance) {
+	return (const float *)(instance->data + HEADER_SIZE);
+}
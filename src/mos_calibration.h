@@ -0,0 +1,70 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Per-chip calibration of the cutoff curve, i.e., the cutoff frequency for
+// each value of the 11-bit cutoff register, loaded from a binary file (write
+// it with octave/writecalibration.m). Files are memory-mapped once per process
+// and shared read-only by all users: opening a path that points to a file
+// already open (same device and inode, or volume and file index on Windows)
+// returns that one. Opening and closing are not realtime-safe.
+//
+// Files must not be changed while open: the curve is validated when mapping,
+// so later changes can reach the filters (which only guard against
+// non-finite and out of range values), and truncating the file makes reading
+// the mapping raise SIGBUS on POSIX systems. Write a new file and rename it
+// over the old one instead, which leaves the mapped one alone to its current
+// users, while opening the path again gets the new one (Windows doesn't allow
+// replacing mapped files, close all users first).
+//
+// File format, little endian:
+//
+//   offset  size   content
+//   0       4      "ASCC"
+//   4       4      version (uint32), 1
+//   8       4      chip model (uint32), ordsp_mos_calibration_model
+//   12      4      number of points (uint32), 2048
+//   16      8192   cutoff frequency in Hz for register values 0 to 2047
+//                  (float32), nondecreasing
+
+#ifndef _ORDSP_MOS_CALIBRATION_H
+#define _ORDSP_MOS_CALIBRATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _ordsp_mos_calibration* ordsp_mos_calibration;
+
+typedef enum {
+	ordsp_mos_calibration_model_8580,
+	ordsp_mos_calibration_model_6581
+} ordsp_mos_calibration_model;
+
+#define ORDSP_MOS_CALIBRATION_POINTS	2048
+
+ordsp_mos_calibration ordsp_mos_calibration_open(const char* path);			// NULL if the file is missing or invalid
+void ordsp_mos_calibration_close(ordsp_mos_calibration instance);			// unmapped when the last user closes it
+ordsp_mos_calibration_model ordsp_mos_calibration_get_model(ordsp_mos_calibration instance);
+const float* ordsp_mos_calibration_get_cutoff_curve(ordsp_mos_calibration instance);	// ORDSP_MOS_CALIBRATION_POINTS values, valid until closed
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,423 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#include "mos_filter.h"
+
+#include "common.h"
+#include "ormath.h"
+#include "ormath_ref.h"
+#include "mos_output_buffer.h"
+
+// Gain structure of the 8580 spice model, also used for the 6581
+static const float kin = 5.838280339378168e-1f;
+static const float Vmin = -4.757f;
+static const float Vmax = 4.243f;
+
+// Nonlinear integrators: the integrator inputs go through a saturating
+// characteristic S(v) = Vsat T(v / Vsat), T(u) = u - u^3 / 3 being the third
+// order Taylor expansion of tanh, which reaches 2/3 with zero slope at 1 and is
+// then held. Vsat is a rough estimate, about the headroom of the integrator
+// op-amps in the spice model.
+
+static const float Vsat = 4.5f;
+
+static inline float sat(float v, float *dv) {
+	const float u = ormath_clipf((1.f / Vsat) * v, -1.f, 1.f);
+	const float u2 = u * u;
+	*dv = 1.f - u2;
+	return Vsat * u * (1.f - (1.f / 3.f) * u2);
+}
+
+// Newton iterations per sample
+static inline int nl_iters(ordsp_mos_filter_quality quality) {
+	switch (quality) {
+	case ordsp_mos_filter_quality_fast:
+		return 1;
+	case ordsp_mos_filter_quality_reference:
+		return 8;
+	default:
+		return 2;
+	}
+}
+
+static inline float tanf_q(float x, ordsp_mos_filter_quality quality) {
+	switch (quality) {
+	case ordsp_mos_filter_quality_fast:
+		// only at low sample rates we get close to the pole
+		return x < 1.2f ? ormath_tanf_pade_3(x) : ormath_tanf_div_3(x);
+	case ordsp_mos_filter_quality_reference:
+		return (float)ormath_tan_ref(x);
+	default:
+		return ormath_tanf_div_3(x);
+	}
+}
+
+static void update_out_coeffs(ordsp_mos_filter instance) {
+	// tan goes negative past pi / 2, that is, below about 31.8 kHz
+	const float t = tanf_q(ormath_minf(50e3f / instance->sample_rate, 1.57f), instance->quality);
+	instance->out_B0 = t / (1.f + t);
+	instance->out_mA1 = (1.f - t) / (1.f + t);
+}
+
+#define PARAM_CUTOFF		1
+#define PARAM_RESONANCE		(1<<1)
+#define PARAM_QUALITY		(1<<2)
+
+void ordsp_mos_filter_init(ordsp_mos_filter instance, const ordsp_mos_filter_model* model) {
+	ordsp_mos_output_buffer_init();
+
+	instance->model = model;
+	instance->quality = ordsp_mos_filter_quality_balanced;
+	instance->nonlinear = 0;
+
+	instance->cutoff = 1.f;
+	instance->cutoff_curve = NULL;
+	instance->resonance = 0.f;
+	instance->param_changed = ~0;
+}
+
+void ordsp_mos_filter_set_sample_rate(ordsp_mos_filter instance, float sample_rate) {
+	instance->in_B0 = sample_rate / (sample_rate + 13.55344121872543f);
+	instance->in_mA1 = (sample_rate - 13.55344121872543f) / (sample_rate + 13.55344121872543f);
+
+	instance->sample_rate = sample_rate;
+	update_out_coeffs(instance);
+
+	instance->dc_B0 = sample_rate / (sample_rate + 3.141592653589793f);
+	instance->dc_mA1 = (sample_rate - 3.141592653589793f) / (sample_rate + 3.141592653589793f);
+
+	instance->B0_low = sample_rate + sample_rate;
+	instance->k1_low = 1.f / instance->B0_low;
+	instance->pi_fs = 3.141592653589793f / sample_rate;
+	instance->param_changed |= PARAM_CUTOFF;	// B0, k1, k2 depend on it
+}
+
+void ordsp_mos_filter_reset(ordsp_mos_filter instance) {
+	instance->param_changed = ~0;
+
+	instance->in_z1 = 0.f;
+	instance->Vbp_z1 = 0.f;
+	instance->dVbp_z1 = 0.f;
+	instance->Vlp_z1 = 0.f;
+	instance->dVlp_z1 = 0.f;
+	instance->out_z1 = 0.f;
+	instance->dc_z1 = 0.f;
+}
+
+// Up to the out lowpass, y = Vb
+static inline void process_svf(ordsp_mos_filter instance, const float* x, float* y, int n_samples, ordsp_mos_filter_quality quality, char nonlinear) {
+	const float kvol = -1.0435f * instance->volume;
+	const float kbypass = -0.8653168127329506f * instance->bypass;
+	const float kmix = -1.59074074074074f;
+	const float hp = kmix * instance->hp;
+	const float bp = kmix * instance->bp;
+	const float lp = kmix * instance->lp;
+	const float in_B0 = instance->in_B0;
+	const float in_mA1 = instance->in_mA1;
+	const float B0 = instance->B0;
+	const float k1 = instance->k1;
+	const float k2 = instance->k2;
+	const float k = instance->k;
+	const float c = k1 * k2;
+	const float Vhp_dVbp_xxz1 = instance->Vhp_dVbp_xxz1;
+	const float Vhp_dVlp_xxz1 = instance->Vhp_dVlp_xxz1;
+	const float Vhp_dVbypass = instance->Vhp_dVbypass;
+	const float out_B0 = instance->out_B0;
+	const float out_mA1 = instance->out_mA1;
+
+	float in_z1 = instance->in_z1;
+	float Vbp_z1 = instance->Vbp_z1;
+	float dVbp_z1 = instance->dVbp_z1;
+	float Vlp_z1 = instance->Vlp_z1;
+	float dVlp_z1 = instance->dVlp_z1;
+	float out_z1 = instance->out_z1;
+
+	for (int i = 0; i < n_samples; i++) {
+		const float Vin = x[i];
+
+		// input
+
+		const float in_x1 = in_B0 * Vin;
+		const float Vbypass = in_x1 + in_z1;
+		in_z1 = in_mA1 * Vbypass - in_x1;
+
+		// filter
+
+		const float dVbp_xxz1 = B0 * Vbp_z1 + dVbp_z1;
+		const float dVlp_xxz1 = B0 * Vlp_z1 + dVlp_z1;
+		float Vhp, Vbp, Vlp;
+		if (nonlinear) {
+			// solve F(Vhp) = Vhp + k Vbp + Vlp + kin Vbypass = 0, with
+			// Vbp = k1 dVbp_xxz1 - c S(Vhp), Vlp = k1 dVlp_xxz1 - c S(Vbp),
+			// by Newton starting from the linear solution, which is exact
+			// until the integrators saturate. F' >= 1 since k < 0, so no
+			// safeguards are needed and the iteration count is fixed.
+			const float Vbp_x = k1 * dVbp_xxz1;
+			const float Vlp_x = k1 * dVlp_xxz1;
+			const float F_x = kin * Vbypass;
+			Vhp = Vhp_dVbp_xxz1 * dVbp_xxz1 + Vhp_dVlp_xxz1 * dVlp_xxz1 + Vhp_dVbypass * Vbypass;
+			for (int j = 0; j < nl_iters(quality); j++) {
+				float dSh, dSb;
+				Vbp = Vbp_x - c * sat(Vhp, &dSh);
+				Vlp = Vlp_x - c * sat(Vbp, &dSb);
+				const float F = Vhp + k * Vbp + Vlp + F_x;
+				const float d = F / (1.f + c * dSh * (c * dSb - k));
+				Vhp -= d;
+				// first order update
+				const float dVbp = c * dSh * d;
+				Vbp += dVbp;
+				Vlp -= c * dSb * dVbp;
+			}
+		} else {
+			Vhp = Vhp_dVbp_xxz1 * dVbp_xxz1 + Vhp_dVlp_xxz1 * dVlp_xxz1 + Vhp_dVbypass * Vbypass;
+			Vbp = k1 * (dVbp_xxz1 - k2 * Vhp);
+			Vlp = k1 * (dVlp_xxz1 - k2 * Vbp);
+		}
+		dVbp_z1 = B0 * Vbp - dVbp_xxz1;
+		dVlp_z1 = B0 * Vlp - dVlp_xxz1;
+		Vbp_z1 = Vbp;
+		Vlp_z1 = Vlp;
+
+		// mix
+
+		const float Vmix = ormath_clipf(hp * Vhp + bp * Vbp + lp * Vlp + kbypass * Vbypass, Vmin, Vmax);
+
+		// volume
+
+		const float Vvol = ormath_clipf(kvol * Vmix, Vmin, Vmax);
+
+		// out lowpass
+
+		const float out_x1 = out_B0 * Vvol;
+		const float Vb = out_x1 + out_z1;
+		out_z1 = out_x1 + out_mA1 * Vb;
+
+		y[i] = Vb;
+	}
+
+	instance->in_z1 = in_z1;
+	instance->Vbp_z1 = Vbp_z1;
+	instance->dVbp_z1 = dVbp_z1;
+	instance->Vlp_z1 = Vlp_z1;
+	instance->dVlp_z1 = dVlp_z1;
+	instance->out_z1 = out_z1;
+}
+
+// Same, linear, in state space form: the integrator states, in volts,
+// q = dV_xxz1 / B0, are updated from each other and from Vbypass, instead of
+// going through Vhp, Vbp and Vlp in turn. Same transfer function, rounding
+// apart, with a much shorter dependency chain per sample. In between calls the
+// states are kept as Vbp_z1 = q, dVbp_z1 = 0, so that switching quality is
+// seamless, but as a cutoff change now also scales the dV part of the states,
+// modulation sounds very slightly different.
+static inline void process_svf_fast(ordsp_mos_filter instance, const float* x, float* y, int n_samples) {
+	const float kvol = -1.0435f * instance->volume;
+	const float kbypass = -0.8653168127329506f * instance->bypass;
+	const float kmix = -1.59074074074074f;
+	const float hp = kmix * instance->hp;
+	const float bp = kmix * instance->bp;
+	const float lp = kmix * instance->lp;
+	const float in_B0 = instance->in_B0;
+	const float in_mA1 = instance->in_mA1;
+	const float out_B0 = instance->out_B0;
+	const float out_mA1 = instance->out_mA1;
+
+	// Vmix before clipping, and next states
+	const float mix_qbp = hp * instance->Vhp_qbp + bp * instance->Vbp_qbp + lp * instance->Vlp_qbp;
+	const float mix_qlp = hp * instance->Vhp_qlp + bp * instance->Vbp_qlp + lp * instance->Vlp_qlp;
+	const float mix_Vbypass = hp * instance->Vhp_dVbypass + bp * instance->Vbp_Vbypass + lp * instance->Vlp_Vbypass + kbypass;
+	const float qbp_qbp = 2.f * instance->Vbp_qbp - 1.f;
+	const float qbp_qlp = 2.f * instance->Vbp_qlp;
+	const float qbp_Vbypass = 2.f * instance->Vbp_Vbypass;
+	const float qlp_qbp = 2.f * instance->Vlp_qbp;
+	const float qlp_qlp = 2.f * instance->Vlp_qlp - 1.f;
+	const float qlp_Vbypass = 2.f * instance->Vlp_Vbypass;
+
+	float in_z1 = instance->in_z1;
+	float qbp = instance->Vbp_z1 + instance->k1 * instance->dVbp_z1;
+	float qlp = instance->Vlp_z1 + instance->k1 * instance->dVlp_z1;
+	float out_z1 = instance->out_z1;
+
+	for (int i = 0; i < n_samples; i++) {
+		const float Vin = x[i];
+
+		const float in_x1 = in_B0 * Vin;
+		const float Vbypass = in_x1 + in_z1;
+		in_z1 = in_mA1 * Vbypass - in_x1;
+
+		const float Vmix = ormath_clipf(mix_qbp * qbp + mix_qlp * qlp + mix_Vbypass * Vbypass, Vmin, Vmax);
+		const float qbp_n = qbp_qbp * qbp + qbp_qlp * qlp + qbp_Vbypass * Vbypass;
+		qlp = qlp_qbp * qbp + qlp_qlp * qlp + qlp_Vbypass * Vbypass;
+		qbp = qbp_n;
+
+		const float Vvol = ormath_clipf(kvol * Vmix, Vmin, Vmax);
+
+		const float out_x1 = out_B0 * Vvol;
+		const float Vb = out_x1 + out_z1;
+		out_z1 = out_x1 + out_mA1 * Vb;
+
+		y[i] = Vb;
+	}
+
+	instance->in_z1 = in_z1;
+	instance->Vbp_z1 = qbp;
+	instance->dVbp_z1 = 0.f;
+	instance->Vlp_z1 = qlp;
+	instance->dVlp_z1 = 0.f;
+	instance->out_z1 = out_z1;
+}
+
+// quality and nonlinear are meant to be constants, so that each call gets specialized
+static inline void process_samples(ordsp_mos_filter instance, const float* x, float* y, int n_samples, ordsp_mos_filter_quality quality, char nonlinear) {
+	if (quality == ordsp_mos_filter_quality_fast && !nonlinear)
+		process_svf_fast(instance, x, y, n_samples);
+	else
+		process_svf(instance, x, y, n_samples, quality, nonlinear);
+
+	// out buffer, y = Ve
+
+	if (quality == ordsp_mos_filter_quality_reference)
+		ordsp_mos_output_buffer_process_ref(y, n_samples);
+	else
+		ordsp_mos_output_buffer_process(y, n_samples);
+
+	// dc block
+
+	const float dc_B0 = instance->dc_B0;
+	const float dc_mA1 = instance->dc_mA1;
+	float dc_z1 = instance->dc_z1;
+	for (int i = 0; i < n_samples; i++) {
+		const float Ve = y[i];
+		const float dc_x1 = dc_B0 * Ve;
+		y[i] = dc_x1 + dc_z1;
+		dc_z1 = dc_mA1 * Ve - dc_x1;
+	}
+	instance->dc_z1 = dc_z1;
+}
+
+void ordsp_mos_filter_process(ordsp_mos_filter instance, const float* x, float* y, int n_samples) {
+	if (instance->param_changed) {
+		if (instance->param_changed & PARAM_QUALITY)
+			update_out_coeffs(instance);
+		if (instance->param_changed & (PARAM_CUTOFF | PARAM_RESONANCE | PARAM_QUALITY)) {
+			if (instance->param_changed & (PARAM_CUTOFF | PARAM_QUALITY)) {
+				const float freq = ormath_minf(instance->cutoff_curve
+					? ordsp_mos_filter_curve_lookup(instance->cutoff_curve, instance->cutoff)
+					: instance->model->cutoff_freq(instance->cutoff), 0.45f * instance->sample_rate);
+				if (freq >= 1.f) {
+					instance->B0 = (6.283185307179586f * freq) / tanf_q(instance->pi_fs * freq, instance->quality);
+					instance->k1 = 1.f / instance->B0;
+				}
+				else {
+					instance->B0 = instance->B0_low;
+					instance->k1 = instance->k1_low;
+				}
+				instance->k2 = 6.283185307179586f * freq;
+			}
+			if (instance->param_changed & PARAM_RESONANCE)
+				instance->k = instance->model->resonance_k(instance->resonance);
+
+			const float Vhp_x1 = instance->k1 * (instance->k1 * instance->k2 - instance->k);
+			const float Vhp_den = 1.f / (instance->k2 * Vhp_x1 + 1.f);
+
+			instance->Vhp_dVbp_xxz1 = Vhp_den * Vhp_x1;
+			instance->Vhp_dVlp_xxz1 = Vhp_den * -instance->k1;
+			instance->Vhp_dVbypass = Vhp_den * -kin;
+
+			// for process_svf_fast(), Vhp, Vbp and Vlp vs q = dV_xxz1 / B0
+			const float g = instance->k1 * instance->k2;
+			const float kq = instance->k1 * instance->B0;
+			instance->Vhp_qbp = instance->Vhp_dVbp_xxz1 * instance->B0;
+			instance->Vhp_qlp = instance->Vhp_dVlp_xxz1 * instance->B0;
+			instance->Vbp_qbp = kq - g * instance->Vhp_qbp;
+			instance->Vbp_qlp = -g * instance->Vhp_qlp;
+			instance->Vbp_Vbypass = -g * instance->Vhp_dVbypass;
+			instance->Vlp_qbp = -g * instance->Vbp_qbp;
+			instance->Vlp_qlp = kq - g * instance->Vbp_qlp;
+			instance->Vlp_Vbypass = -g * instance->Vbp_Vbypass;
+		}
+		instance->param_changed = 0;
+	}
+
+	if (instance->nonlinear)
+		switch (instance->quality) {
+		case ordsp_mos_filter_quality_fast:
+			process_samples(instance, x, y, n_samples, ordsp_mos_filter_quality_fast, 1);
+			break;
+		case ordsp_mos_filter_quality_reference:
+			process_samples(instance, x, y, n_samples, ordsp_mos_filter_quality_reference, 1);
+			break;
+		default:
+			process_samples(instance, x, y, n_samples, ordsp_mos_filter_quality_balanced, 1);
+		}
+	else
+		switch (instance->quality) {
+		case ordsp_mos_filter_quality_fast:
+			process_samples(instance, x, y, n_samples, ordsp_mos_filter_quality_fast, 0);
+			break;
+		case ordsp_mos_filter_quality_reference:
+			process_samples(instance, x, y, n_samples, ordsp_mos_filter_quality_reference, 0);
+			break;
+		default:
+			process_samples(instance, x, y, n_samples, ordsp_mos_filter_quality_balanced, 0);
+		}
+}
+
+void ordsp_mos_filter_set_cutoff_curve(ordsp_mos_filter instance, const float* value) {
+	if (instance->cutoff_curve != value) {
+		instance->cutoff_curve = value;
+		instance->param_changed |= PARAM_CUTOFF;
+	}
+}
+
+void ordsp_mos_filter_set_cutoff(ordsp_mos_filter instance, float value) {
+	if (instance->cutoff != value) {
+		instance->cutoff = value;
+		instance->param_changed |= PARAM_CUTOFF;
+	}
+}
+
+void ordsp_mos_filter_set_resonance(ordsp_mos_filter instance, float value) {
+	if (instance->resonance != value) {
+		instance->resonance = value;
+		instance->param_changed |= PARAM_RESONANCE;
+	}
+}
+
+void ordsp_mos_filter_set_volume(ordsp_mos_filter instance, float value) {
+	instance->volume = value;
+}
+
+void ordsp_mos_filter_set_mode(ordsp_mos_filter instance, float bypass, float lp, float bp, float hp) {
+	instance->bypass = bypass;
+	instance->lp = lp;
+	instance->bp = bp;
+	instance->hp = hp;
+}
+
+void ordsp_mos_filter_set_quality(ordsp_mos_filter instance, ordsp_mos_filter_quality value) {
+	if (instance->quality != value) {
+		instance->quality = value;
+		instance->param_changed |= PARAM_QUALITY;
+	}
+}
+
+void ordsp_mos_filter_set_nonlinear(ordsp_mos_filter instance, char value) {
+	instance->nonlinear = value;
+}
@@ -0,0 +1,130 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Internal, not part of the public API: what the MOS filter models have in
+// common, that is, all but the cutoff curve and the resonance law. Input
+// coupling, SVF (linear or with saturating integrators), mix and volume
+// clipping, out lowpass, output buffer, dc block, and the quality tiers. Each
+// model's handle points to a struct _ordsp_mos_filter initialized with its
+// ordsp_mos_filter_model, and its quality enum has the same values as
+// ordsp_mos_filter_quality.
+
+#ifndef _ORDSP_MOS_FILTER_H
+#define _ORDSP_MOS_FILTER_H
+
+#include "ormath.h"
+
+typedef enum {
+	ordsp_mos_filter_quality_fast,
+	ordsp_mos_filter_quality_balanced,
+	ordsp_mos_filter_quality_reference
+} ordsp_mos_filter_quality;
+
+// Called at control rate only
+typedef struct {
+	float	(*cutoff_freq)(float value);	// Hz, built-in curve, value as in set_cutoff()
+	float	(*resonance_k)(float value);	// SVF k (< 0), value as in set_resonance()
+} ordsp_mos_filter_model;
+
+typedef struct _ordsp_mos_filter* ordsp_mos_filter;
+
+struct _ordsp_mos_filter {
+	const ordsp_mos_filter_model* model;
+
+	// Coefficients
+	float sample_rate;
+	float in_B0;
+	float in_mA1;
+	float out_B0;
+	float out_mA1;
+	float dc_B0;
+	float dc_mA1;
+	float B0_low;
+	float k1_low;
+	float pi_fs;
+
+	float B0;
+	float k1;
+	float k2;
+	float k;
+	float Vhp_dVbp_xxz1;
+	float Vhp_dVlp_xxz1;
+	float Vhp_dVbypass;
+	float Vhp_qbp;
+	float Vhp_qlp;
+	float Vbp_qbp;
+	float Vbp_qlp;
+	float Vbp_Vbypass;
+	float Vlp_qbp;
+	float Vlp_qlp;
+	float Vlp_Vbypass;
+
+	// Parameters
+	float cutoff;
+	const float* cutoff_curve;	// NULL = built-in
+	float resonance;
+	float volume;
+	float bypass;
+	float lp;
+	float bp;
+	float hp;
+	ordsp_mos_filter_quality quality;
+	char nonlinear;
+	int param_changed;
+
+	// States
+	float in_z1;
+	float Vbp_z1;
+	float dVbp_z1;
+	float Vlp_z1;
+	float dVlp_z1;
+	float out_z1;
+	float dc_z1;
+};
+
+void ordsp_mos_filter_init(ordsp_mos_filter instance, const ordsp_mos_filter_model* model);
+void ordsp_mos_filter_set_sample_rate(ordsp_mos_filter instance, float sample_rate);
+void ordsp_mos_filter_reset(ordsp_mos_filter instance);
+void ordsp_mos_filter_process(ordsp_mos_filter instance, const float* x, float* y, int n_samples);
+void ordsp_mos_filter_set_cutoff(ordsp_mos_filter instance, float value);
+void ordsp_mos_filter_set_cutoff_curve(ordsp_mos_filter instance, const float* value);
+void ordsp_mos_filter_set_resonance(ordsp_mos_filter instance, float value);
+void ordsp_mos_filter_set_volume(ordsp_mos_filter instance, float value);
+void ordsp_mos_filter_set_mode(ordsp_mos_filter instance, float bypass, float lp, float bp, float hp);
+void ordsp_mos_filter_set_quality(ordsp_mos_filter instance, ordsp_mos_filter_quality value);
+void ordsp_mos_filter_set_nonlinear(ordsp_mos_filter instance, char value);
+
+// Linear interpolation between the 2048 register values of a cutoff curve
+// Calibration files are validated when opened, but could still change while
+// mapped: non-finite points count as 0 Hz, the others are clipped to the valid
+// range (the check works with -ffast-math)
+static inline float ordsp_mos_filter_curve_point(const float* curve, int i) {
+	ormath_floatint v = {.f = curve[i]};
+	return (v.i & 0x7f800000) == 0x7f800000 ? 0.f : ormath_clipf(v.f, 0.f, 1e6f);
+}
+
+static inline float ordsp_mos_filter_curve_lookup(const float* curve, float value) {
+	const float x = 2047.f * ormath_clipf(value, 0.f, 1.f);
+	const int i = ormath_mini32((int)x, 2046);
+	const float y0 = ordsp_mos_filter_curve_point(curve, i);
+	const float y1 = ordsp_mos_filter_curve_point(curve, i + 1);
+	return y0 + (x - (float)i) * (y1 - y0);
+}
+
+#endif
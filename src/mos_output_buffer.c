@@ -0,0 +1,139 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#include "mos_output_buffer.h"
+
+#include "common.h"
+#include "ormath.h"
+#include "ormath_ref.h"
+
+// AVX2 gathers for the table lookup, always if the compiler targets AVX2,
+// otherwise where the CPU supports it, checked once at init
+#if defined(__AVX2__) && !defined(ORDSP_NO_SIMD)
+# define OB_AVX2
+# define OB_AVX2_TARGET
+# include <immintrin.h>
+#elif (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)) && !defined(ORDSP_NO_SIMD)
+# define OB_AVX2
+# define OB_AVX2_DISPATCH
+# include <immintrin.h>
+# if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#  define OB_AVX2_TARGET
+# else
+#  define OB_AVX2_TARGET	__attribute__((target("avx2")))
+# endif
+#endif
+
+// Output buffer transfer function Vb -> Ve, sampled from the exact omega
+// function, linearly interpolated. Vb is the output of the out lowpass, whose
+// input the filter models clip to [Vmin, Vmax] = [-4.757, 4.243]: at low sample
+// rates its pole gets negative and it can overshoot, but by less than half that
+// range on either side.
+
+#define VE_TABLE_N	2048
+#define VB_MIN		-9.257f	// Vmin - 0.5f * (Vmax - Vmin)
+#define VB_MAX		8.743f	// Vmax + 0.5f * (Vmax - Vmin)
+
+static float ve_table[VE_TABLE_N + 1];
+static float ve_table_d[VE_TABLE_N];
+static volatile long ve_table_state;
+#ifdef OB_AVX2_DISPATCH
+static char use_avx2;
+
+static char cpu_has_avx2(void) {
+# if defined(_MSC_VER) && !defined(__clang__)
+	int r[4];
+	__cpuid(r, 0);
+	if (r[0] < 7)
+		return 0;
+	__cpuid(r, 1);
+	if (!(r[2] & (1 << 27)) || (_xgetbv(0) & 6) != 6)	// OSXSAVE, OS saves ymm
+		return 0;
+	__cpuidex(r, 7, 0);
+	return (r[1] & (1 << 5)) != 0;
+# else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+# endif
+}
+#endif
+
+static void ve_table_init(void) {
+	const double Ve_k = 0.026 * ormath_omega_ref(159.6931258945051);
+	for (int i = 0; i <= VE_TABLE_N; i++) {
+		const double Vb = VB_MIN + (double)(VB_MAX - VB_MIN) * i / VE_TABLE_N;
+		ve_table[i] = (float)(0.026 * ormath_omega_ref(38.46153846153846 * Vb + 159.6931258945051) - Ve_k);
+	}
+	for (int i = 0; i < VE_TABLE_N; i++)
+		ve_table_d[i] = ve_table[i + 1] - ve_table[i];
+#ifdef OB_AVX2_DISPATCH
+	use_avx2 = cpu_has_avx2();
+#endif
+}
+
+void ordsp_mos_output_buffer_init() {
+	ordsp_once(&ve_table_state, ve_table_init);
+}
+
+// out of range values get linearly extrapolated
+static inline float ve_lookup(float Vb) {
+	const float u = (Vb - VB_MIN) * ((float)VE_TABLE_N / (VB_MAX - VB_MIN));
+	const int i = ormath_clipi32((int)u, 0, VE_TABLE_N - 1);
+	return ve_table[i] + (u - (float)i) * ve_table_d[i];
+}
+
+#ifdef OB_AVX2
+// Returns how many samples it processed, a multiple of 8
+OB_AVX2_TARGET static int process_avx2(float* y, int n_samples) {
+	int i = 0;
+	const __m256 k = _mm256_set1_ps((float)VE_TABLE_N / (VB_MAX - VB_MIN));
+	const __m256 Vb_min = _mm256_set1_ps(VB_MIN);
+	const __m256i i_max = _mm256_set1_epi32(VE_TABLE_N - 1);
+	const __m256i i_min = _mm256_setzero_si256();
+	for (; i + 8 <= n_samples; i += 8) {
+		const __m256 u = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(y + i), Vb_min), k);
+		const __m256i j = _mm256_min_epi32(_mm256_max_epi32(_mm256_cvttps_epi32(u), i_min), i_max);
+		const __m256 f = _mm256_sub_ps(u, _mm256_cvtepi32_ps(j));
+		const __m256 v0 = _mm256_i32gather_ps(ve_table, j, 4);
+		const __m256 d = _mm256_i32gather_ps(ve_table_d, j, 4);
+		_mm256_storeu_ps(y + i, _mm256_add_ps(v0, _mm256_mul_ps(f, d)));
+	}
+	return i;
+}
+#endif
+
+void ordsp_mos_output_buffer_process(float* y, int n_samples) {
+	int i = 0;
+#if defined(OB_AVX2_DISPATCH)
+	if (use_avx2)
+		i = process_avx2(y, n_samples);
+#elif defined(OB_AVX2)
+	i = process_avx2(y, n_samples);
+#endif
+	for (; i < n_samples; i++)
+		y[i] = ve_lookup(y[i]);
+}
+
+
+void ordsp_mos_output_buffer_process_ref(float* y, int n_samples) {
+	const float Ve_k = 0.026f * (float)ormath_omega_ref(159.6931258945051f);
+	for (int i = 0; i < n_samples; i++)
+		y[i] = 0.026f * (float)ormath_omega_ref(38.46153846153846f * y[i] + 159.6931258945051f) - Ve_k;
+}
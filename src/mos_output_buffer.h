@@ -0,0 +1,38 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Output buffer of the MOS 8580/6581 SID (source follower), common to the
+// filter models: Vb -> Ve, Ve without its DC component at rest.
+
+#ifndef _ORDSP_MOS_OUTPUT_BUFFER_H
+#define _ORDSP_MOS_OUTPUT_BUFFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ordsp_mos_output_buffer_init();						// builds the shared table once per process, call when creating instances
+void ordsp_mos_output_buffer_process(float* y, int n_samples);			// in place, table lookup
+void ordsp_mos_output_buffer_process_ref(float* y, int n_samples);		// in place, exact omega function, slow
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
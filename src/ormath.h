@@ -126,13 +126,13 @@ static inline float ormath_truncf(float x) {
 static inline float ormath_roundf(float x) {
 	ormath_floatint v = {.f = x};
 	int32_t ex = (v.i & 0x7f800000) >> 23;
-	int32_t sh = ormath_clipi32(150 - ex, 0, 23);
+	int32_t sh = ormath_clipi32(150 - ex, 0, 24);
 	int32_t mt = (~0) << sh;
 	mt &= ormath_signexti32(126 - ex) | 0x80000000;
 	int32_t mr = (1 << sh) >> 1;
 	mr &= ormath_signexti32(125 - ex);
 	ormath_floatint s = {.f = ormath_signf(x)};
-	int32_t ms = ormath_signexti32((v.i & mr) << (32 - sh));
+	int32_t ms = ormath_signexti32(((v.i | 0x00800000) & mr) << (32 - sh)); // implicit bit is the rounding bit in [0.5, 1)
 	v.i &= mt;
 	s.i &= ms;
 	return v.f + s.f;
@@ -163,6 +163,12 @@ static inline float ormath_tanf_div_3(float x) {
 	return ormath_sinf_3(x) / ormath_cosf_3(x);
 }
 
+// [3/2] Padé approximant, pole at sqrt(5/2) so only good in (-pi/2, pi/2)
+static inline float ormath_tanf_pade_3(float x) {
+	const float x2 = x * x;
+	return x * (15.f - x2) / (15.f - 6.f * x2);
+}
+
 static inline float ormath_log2f_3(float x) {
 	ormath_floatint v = {.f = x};
 	int ex = v.i & 0x7f800000;
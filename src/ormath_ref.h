@@ -0,0 +1,68 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ *
+ * Reference (i.e., slow but accurate) counterparts of the approximations in
+ * ormath.h, computed in double precision using libm.
+ *
+ * The Wright omega function is computed using Fritsch's iteration as described
+ * in
+ *
+ * P. W. Lawrence, R. M. Corless, and D. J. Jeffrey, "Algorithm 917: Complex
+ * Double-Precision Evaluation of the Wright omega Function", ACM Transactions
+ * on Mathematical Software, vol. 38, no. 3, April 2012.
+ */
+
+#ifndef _ORMATH_REF_H
+#define _ORMATH_REF_H
+
+#include <math.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline double ormath_tan_ref(double x) {
+	return tan(x);
+}
+
+// omega(x) = lambertw(exp(x)), i.e., the solution of w + log(w) = x
+static inline double ormath_omega_ref(double x) {
+	if (x < -36.0)
+		return exp(x); // exact to double precision
+	double w;
+	if (x <= -2.0)
+		w = exp(x);
+	else if (x > 1.0)
+		w = x - log(x);
+	else
+		w = 6.313183464296682e-1 + x * (3.631952663804445e-1 + x * (4.775931364975583e-2 + x * -1.314293149877800e-3));
+	// quartic convergence, 3 iterations are enough for double precision
+	for (int i = 0; i < 3; i++) {
+		const double z = x - w - log(w);
+		const double w1 = 1.0 + w;
+		const double q = 2.0 * w1 * (w1 + (2.0 / 3.0) * z);
+		w = w * (1.0 + z / w1 * (q - z) / (q - 2.0 * z));
+	}
+	return w;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Real FFT of size n computed as a complex radix-2 FFT of size n / 2 on the
+// even/odd samples packed as real/imaginary parts, followed by a split step.
+
+#include "fft.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct _fft {
+	size_t		 n;
+	size_t		 m;		// n / 2
+	double complex	*tw;		// exp(-2 pi i k / m), k in [0, m / 2)
+	double complex	*tw_split;	// exp(-2 pi i k / n), k in [0, m]
+	size_t		*rev;		// bit reversal permutation of [0, m)
+	double complex	*z;		// scratch, m values
+};
+
+fft fft_new(size_t n) {
+	if (n < 4 || (n & (n - 1)))
+		return NULL;
+	fft instance = (fft)malloc(sizeof(struct _fft));
+	if (instance == NULL)
+		return NULL;
+	instance->n = n;
+	instance->m = n >> 1;
+	instance->tw = (double complex *)malloc((instance->m >> 1) * sizeof(double complex));
+	instance->tw_split = (double complex *)malloc((instance->m + 1) * sizeof(double complex));
+	instance->rev = (size_t *)malloc(instance->m * sizeof(size_t));
+	instance->z = (double complex *)malloc(instance->m * sizeof(double complex));
+	if (!instance->tw || !instance->tw_split || !instance->rev || !instance->z) {
+		fft_free(instance);
+		return NULL;
+	}
+
+	const size_t m = instance->m;
+	for (size_t k = 0; k < (m >> 1); k++)
+		instance->tw[k] = cexp(-2.0 * M_PI * I * (double)k / (double)m);
+	for (size_t k = 0; k <= m; k++)
+		instance->tw_split[k] = cexp(-2.0 * M_PI * I * (double)k / (double)n);
+
+	int bits = 0;
+	while (((size_t)1 << bits) < m)
+		bits++;
+	for (size_t k = 0; k < m; k++) {
+		size_t r = 0;
+		for (int b = 0; b < bits; b++)
+			r |= ((k >> b) & 1) << (bits - 1 - b);
+		instance->rev[k] = r;
+	}
+
+	return instance;
+}
+
+void fft_free(fft instance) {
+	free(instance->tw);
+	free(instance->tw_split);
+	free(instance->rev);
+	free(instance->z);
+	free(instance);
+}
+
+size_t fft_get_size(fft instance) {
+	return instance->n;
+}
+
+// In place, z already in bit-reversed order. inverse uses conjugate twiddles
+// and does not scale.
+static void fft_complex(fft instance, double complex *z, char inverse) {
+	const size_t m = instance->m;
+	for (size_t len = 2; len <= m; len <<= 1) {
+		const size_t half = len >> 1;
+		const size_t step = m / len;
+		for (size_t i = 0; i < m; i += len)
+			for (size_t j = 0; j < half; j++) {
+				const double complex w = inverse ? conj(instance->tw[j * step]) : instance->tw[j * step];
+				const double complex a = z[i + j];
+				const double complex b = w * z[i + j + half];
+				z[i + j] = a + b;
+				z[i + j + half] = a - b;
+			}
+	}
+}
+
+void fft_forward(fft instance, const double *x, double complex *X) {
+	const size_t m = instance->m;
+	double complex *z = instance->z;
+	for (size_t k = 0; k < m; k++)
+		z[instance->rev[k]] = CMPLX(x[2 * k], x[2 * k + 1]);
+	fft_complex(instance, z, 0);
+
+	for (size_t k = 0; k <= m; k++) {
+		const double complex a = z[k == m ? 0 : k];
+		const double complex b = conj(z[k == 0 ? 0 : m - k]);
+		const double complex e = 0.5 * (a + b);
+		const double complex o = -0.5 * I * (a - b);
+		X[k] = e + instance->tw_split[k] * o;
+	}
+}
+
+void fft_inverse(fft instance, double complex *X, double *x) {
+	const size_t m = instance->m;
+	double complex *z = instance->z;
+	for (size_t k = 0; k < m; k++) {
+		const double complex a = X[k];
+		const double complex b = conj(X[m - k]);
+		const double complex e = 0.5 * (a + b);
+		const double complex o = 0.5 * (a - b) * conj(instance->tw_split[k]);
+		z[instance->rev[k]] = e + I * o;
+	}
+	fft_complex(instance, z, 1);
+
+	const double s = 1.0 / (double)m;
+	for (size_t k = 0; k < m; k++) {
+		x[2 * k] = s * creal(z[k]);
+		x[2 * k + 1] = s * cimag(z[k]);
+	}
+}
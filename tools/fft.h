@@ -0,0 +1,40 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#ifndef _FFT_H
+#define _FFT_H
+
+#include <complex.h>
+#include <stddef.h>
+
+typedef struct _fft* fft;
+
+// n: power of 2, >= 4
+fft fft_new(size_t n);
+void fft_free(fft instance);
+size_t fft_get_size(fft instance);
+
+// x: n real values, X: n / 2 + 1 complex values (non-negative frequencies)
+// x and X can't overlap
+void fft_forward(fft instance, const double *x, double complex *X);
+
+// inverse of fft_forward (scaled by 1 / n), X is overwritten
+void fft_inverse(fft instance, double complex *X, double *x);
+
+#endif
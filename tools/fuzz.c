@@ -0,0 +1,482 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ *
+ * Randomized checks of the sound engine, meant to catch optimizations that
+ * silently change the output:
+ *
+ *   - block size invariance: asid_process() and ordsp_mos_8580_filter_process()
+ *     on random signals and parameter sequences must give bit-identical output
+ *     whether each segment between parameter changes is processed at once or
+ *     split into random blocks (including 1, odd sizes, and sizes around the
+ *     control rate update interval);
+ *   - sample rate changes: a filter (either model) that processed silence
+ *     at one sample rate and is then set to another one, without reset, must
+ *     give the same output as a new filter at the second sample rate, but for
+ *     what is left in the dc blocker by the output buffer offset;
+ *   - untrusted parameters: random values and bit patterns (NaN, infinities,
+ *     out of range) through all setters and through state blobs read the way
+ *     the VST3 Plugin::setState() does, must keep the output finite;
+ *   - SIMD vs scalar: the digest of all outputs of the first check is printed
+ *     and must match that of the same program built with -DORDSP_NO_SIMD
+ *     (make check does that).
+ *
+ * Usage: fuzz [-s seed] [-i iterations] [-v]
+ * Exit status is 0 if all checks pass.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "asid.h"
+#include "mos_8580_filter.h"
+#include "mos_6581_filter.h"
+#include "../vst3/src/vst3/state.h"
+
+#define MAX_LENGTH	20000
+#define MAX_EVENTS	8
+
+static uint64_t rng_state;
+
+static uint32_t rng(void) {
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+	return (uint32_t)(rng_state >> 32);
+}
+
+static int rng_int(int min, int max) {
+	return min + (int)(rng() % (uint32_t)(max - min + 1));
+}
+
+static float rng_float(float min, float max) {
+	return min + (max - min) * (float)(rng() >> 8) * (1.f / 16777216.f);
+}
+
+// Random block size, biased towards the interesting ones
+static int block_size(int update_samples) {
+	switch (rng_int(0, 5)) {
+	case 0:
+		return 1;
+	case 1:
+		return 2 * rng_int(0, 16) + 1;
+	case 2:
+		return update_samples + rng_int(-1, 1);
+	case 3:
+		return (update_samples >> 1) + rng_int(-1, 1);
+	case 4:
+		return (update_samples >> 2) + rng_int(-1, 1);
+	default:
+		return rng_int(1, 2048);
+	}
+}
+
+static void random_signal(float* x, int n) {
+	const float a = rng_float(0.f, 2.f);
+	switch (rng_int(0, 2)) {
+	case 0:
+		for (int i = 0; i < n; i++)
+			x[i] = rng_float(-a, a);
+		break;
+	case 1:
+		{
+			const float w = rng_float(0.001f, 0.5f);
+			for (int i = 0; i < n; i++)
+				x[i] = a * sinf(w * (float)i);
+		}
+		break;
+	default:
+		for (int i = 0; i < n; i++)
+			x[i] = i % rng_int(50, 5000) == 0 ? a : 0.f;
+	}
+}
+
+static uint64_t digest = 0xcbf29ce484222325ull;
+
+static void digest_add(const float* y, int n) {
+	const unsigned char *p = (const unsigned char *)y;
+	for (size_t i = 0; i < (size_t)n * sizeof(float); i++) {
+		digest ^= p[i];
+		digest *= 0x100000001b3ull;
+	}
+}
+
+static int compare(const char* what, int iter, const float* y_ref, const float* y, int n) {
+	if (memcmp(y_ref, y, n * sizeof(float)) == 0)
+		return 0;
+	int i = 0;
+	while (memcmp(y_ref + i, y + i, sizeof(float)) == 0)
+		i++;
+	fprintf(stderr, "%s, iteration %d: output differs at sample %d (%.9g vs %.9g)\n", what, iter, i, y_ref[i], y[i]);
+	return 1;
+}
+
+// Parameter changes at random positions, segment k is [pos[k], pos[k + 1])
+typedef struct {
+	int	n;
+	int	pos[MAX_EVENTS + 2];
+	float	values[MAX_EVENTS + 1][8];
+} events;
+
+static void events_new(events* e, int length) {
+	e->n = rng_int(0, MAX_EVENTS);
+	e->pos[0] = 0;
+	for (int k = 1; k <= e->n; k++)
+		e->pos[k] = rng_int(0, length);
+	e->pos[e->n + 1] = length;
+	for (int k = 1; k <= e->n; k++)	// insertion sort, positions can repeat
+		for (int j = k; j > 1 && e->pos[j] < e->pos[j - 1]; j--) {
+			const int t = e->pos[j];
+			e->pos[j] = e->pos[j - 1];
+			e->pos[j - 1] = t;
+		}
+	for (int k = 0; k <= e->n; k++)
+		for (int j = 0; j < 8; j++)
+			e->values[k][j] = rng_float(0.f, 1.f);
+}
+
+static void filter_set(ordsp_mos_8580_filter f, const float* v) {
+	ordsp_mos_8580_filter_set_cutoff(f, v[0]);
+	ordsp_mos_8580_filter_set_resonance(f, v[1]);
+	ordsp_mos_8580_filter_set_volume(f, v[2]);
+	ordsp_mos_8580_filter_set_mode(f, v[3] < 0.2f, v[4] < 0.5f, v[5] < 0.5f, v[6] < 0.5f);
+}
+
+static void filter_run(ordsp_mos_8580_filter f, const events* e, const float* x, float* y, char split) {
+	ordsp_mos_8580_filter_reset(f);
+	for (int k = 0; k <= e->n; k++) {
+		filter_set(f, e->values[k]);
+		for (int i = e->pos[k]; i < e->pos[k + 1]; ) {
+			int n = e->pos[k + 1] - i;
+			if (split) {
+				const int b = block_size(441);
+				n = b < n ? b : n;
+			}
+			ordsp_mos_8580_filter_process(f, x + i, y + i, n);
+			i += n;
+		}
+	}
+}
+
+static int check_filter(int iter, float* x, float* y_ref, float* y, int verbose) {
+	static const float sample_rates[] = { 22050.f, 44100.f, 48000.f, 96000.f };
+	ordsp_mos_8580_filter f = ordsp_mos_8580_filter_new();
+	if (f == NULL) {
+		fprintf(stderr, "out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+	const float fs = sample_rates[rng_int(0, 3)];
+	const int quality = rng_int(0, 2);
+	const int nonlinear = rng_int(0, 1);
+	const int length = rng_int(1, MAX_LENGTH);
+	ordsp_mos_8580_filter_set_sample_rate(f, fs);
+	ordsp_mos_8580_filter_set_quality(f, (ordsp_mos_8580_filter_quality)quality);
+	ordsp_mos_8580_filter_set_nonlinear(f, nonlinear);
+	random_signal(x, length);
+	events e;
+	events_new(&e, length);
+	if (verbose)
+		printf("filter %d: fs %g, quality %d, nonlinear %d, length %d, %d events\n", iter, fs, quality, nonlinear, length, e.n);
+
+	filter_run(f, &e, x, y_ref, 0);
+	filter_run(f, &e, x, y, 1);
+	ordsp_mos_8580_filter_free(f);
+	digest_add(y_ref, length);
+	return compare("filter", iter, y_ref, y, length);
+}
+
+// Runs of a at fs1 and then fs2, and of b at fs2 only
+#define SAMPLE_RATE_RUN(t, fs1, fs2, v, x, y_ref, y, length) \
+	{ \
+		t a = t##_new(); \
+		t b = t##_new(); \
+		if (a == NULL || b == NULL) { \
+			fprintf(stderr, "out of memory\n"); \
+			exit(EXIT_FAILURE); \
+		} \
+		t##_set_sample_rate(a, fs1); \
+		t##_reset(a); \
+		t##_set_cutoff(a, v[0]); \
+		t##_set_resonance(a, v[1]); \
+		t##_set_volume(a, v[2]); \
+		t##_set_mode(a, 0.f, v[4] < 0.5f, v[5] < 0.5f, v[6] < 0.5f); \
+		memset(y, 0, length * sizeof(float)); \
+		t##_process(a, y, y, length); \
+		t##_set_sample_rate(a, fs2); \
+		t##_process(a, x, y, length); \
+		t##_set_sample_rate(b, fs2); \
+		t##_reset(b); \
+		t##_set_cutoff(b, v[0]); \
+		t##_set_resonance(b, v[1]); \
+		t##_set_volume(b, v[2]); \
+		t##_set_mode(b, 0.f, v[4] < 0.5f, v[5] < 0.5f, v[6] < 0.5f); \
+		t##_process(b, x, y_ref, length); \
+		t##_free(a); \
+		t##_free(b); \
+	}
+
+static int check_sample_rate(int iter, float* x, float* y_ref, float* y, int verbose) {
+	static const float sample_rates[] = { 22050.f, 44100.f, 48000.f, 96000.f };
+	const float fs1 = sample_rates[rng_int(0, 3)];
+	const float fs2 = sample_rates[rng_int(0, 3)];
+	const int model = rng_int(0, 1);
+	const int length = rng_int(1, MAX_LENGTH);
+	float v[8];
+	for (int j = 0; j < 8; j++)
+		v[j] = rng_float(0.f, 1.f);
+	random_signal(x, length);
+	if (verbose)
+		printf("sample rate %d: model %d, fs %g to %g, length %d\n", iter, model, fs1, fs2, length);
+
+	if (model)
+		SAMPLE_RATE_RUN(ordsp_mos_6581_filter, fs1, fs2, v, x, y_ref, y, length)
+	else
+		SAMPLE_RATE_RUN(ordsp_mos_8580_filter, fs1, fs2, v, x, y_ref, y, length)
+	for (int i = 0; i < length; i++)
+		if (!(fabsf(y[i] - y_ref[i]) <= 1e-4f)) {
+			fprintf(stderr, "sample rate, iteration %d: output differs at sample %d (%.9g vs %.9g)\n", iter, i, y_ref[i], y[i]);
+			return 1;
+		}
+	return 0;
+}
+
+typedef struct {
+	float	fs;
+	int	model;
+	int	quality;
+	int	decimation;
+	int	stages;
+	float	stage_values[ASID_STAGES_MAX][6];
+} asid_setup;
+
+static void asid_configure(asid a, const asid_setup* s) {
+	asid_set_sample_rate(a, s->fs);
+	asid_set_quality(a, (asid_quality)s->quality);
+	asid_set_model(a, (asid_model)s->model);
+	asid_set_decimation(a, s->decimation);
+	asid_set_stages(a, s->stages);
+	for (int k = 0; k < ASID_STAGES_MAX; k++) {
+		const float *v = s->stage_values[k];
+		asid_set_stage_cutoff_offset(a, k, 2.f * v[0] - 1.f);
+		asid_set_stage_lfo_offset(a, k, v[1]);
+		asid_set_stage_mode(a, k, v[2] < 0.5f, v[3] < 0.5f, v[4] < 0.5f);
+		asid_set_stage_volume(a, k, v[5]);
+	}
+}
+
+static void asid_set(asid a, const float* v) {
+	static const int index[6] = { 0, 1, 2, 4, 5, 6 };
+	for (int j = 0; j < 6; j++)
+		asid_set_parameter(a, index[j], v[j]);
+}
+
+// Split runs are also in caller memory filled with garbage, so that anything
+// left uninitialized by asid_new_in() and asid_reset() shows up as a mismatch
+static void asid_run(const asid_setup* s, const events* e, const float* x, float* y, char split) {
+	void *mem = malloc(asid_mem_req());
+	if (mem == NULL) {
+		fprintf(stderr, "out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+	memset(mem, split ? 0xa5 : 0, asid_mem_req());
+	asid a = asid_new_in(mem);
+	asid_configure(a, s);
+	asid_reset(a);
+	const int update_samples = (int)(0.01f * s->fs + 0.5f);
+	for (int k = 0; k <= e->n; k++) {
+		asid_set(a, e->values[k]);
+		for (int i = e->pos[k]; i < e->pos[k + 1]; ) {
+			int n = e->pos[k + 1] - i;
+			if (split) {
+				const int b = block_size(update_samples);
+				n = b < n ? b : n;
+			}
+			const float *xp = x + i;
+			float *yp = y + i;
+			asid_process(a, &xp, &yp, n);
+			i += n;
+		}
+	}
+	asid_fini(a);
+	free(mem);
+}
+
+static int check_asid(int iter, float* x, float* y_ref, float* y, int verbose) {
+	static const float sample_rates[] = { 22050.f, 44100.f, 48000.f, 88200.f, 96000.f, 192000.f };
+	asid_setup s;
+	s.fs = sample_rates[rng_int(0, 5)];
+	s.model = rng_int(0, asid_model_n - 1);
+	s.quality = rng_int(0, 1);	// reference is covered by the filter check, and slow
+	s.decimation = rng_int(0, 1);
+	s.stages = rng_int(1, ASID_STAGES_MAX);
+	for (int k = 0; k < ASID_STAGES_MAX; k++)
+		for (int j = 0; j < 6; j++)
+			s.stage_values[k][j] = rng_float(0.f, 1.f);
+	const int length = rng_int(1, MAX_LENGTH);
+	random_signal(x, length);
+	events e;
+	events_new(&e, length);
+	if (verbose)
+		printf("asid %d: fs %g, model %d, quality %d, decimation %d, stages %d, length %d, %d events\n", iter, s.fs, s.model, s.quality, s.decimation, s.stages, length, e.n);
+
+	asid_run(&s, &e, x, y_ref, 0);
+	asid_run(&s, &e, x, y, 1);
+	digest_add(y_ref, length);
+	return compare("asid", iter, y_ref, y, length);
+}
+
+// Mostly nasty values
+static float untrusted_float(void) {
+	static const uint32_t patterns[] = { 0x7fc00000, 0xffc00000, 0x7f800000, 0xff800000, 0x7f7fffff, 0xff7fffff, 0x00000001, 0x80000000 };
+	union { uint32_t u; float f; } v;
+	switch (rng_int(0, 3)) {
+	case 0:
+		v.u = patterns[rng_int(0, 7)];
+		return v.f;
+	case 1:
+		v.u = rng();
+		return v.f;
+	case 2:
+		return rng_float(-10.f, 10.f);
+	default:
+		return rng_float(0.f, 1.f);
+	}
+}
+
+// Mirrors Plugin::setState(), parameter ids, outputs and defaults as in
+// vst3/src/vst3/config.h
+static void set_state(asid a, const unsigned char* data, int size) {
+	static const char out[7] = { 0, 0, 0, 1, 0, 0, 0 };
+	static const float def[7] = { 1.f, 0.f, 0.5f, 0.f, 0.f, 0.3f, 0.5f };
+	int j = 0;
+	for (int i = 0; i < 7; i++) {
+		if (out[i])
+			continue;
+		float f;
+		if (4 * (j + 1) > size) {
+			if (j == 0)
+				return;
+			f = def[i];
+		} else {
+			union { uint32_t u; float f; } v;
+			v.u = (uint32_t)data[4 * j] | ((uint32_t)data[4 * j + 1] << 8) | ((uint32_t)data[4 * j + 2] << 16) | ((uint32_t)data[4 * j + 3] << 24);
+			f = stateSanitize(v.f, def[i]);
+			j++;
+		}
+		asid_set_parameter(a, i, f);
+	}
+}
+
+static int check_untrusted(int iter, float* x, float* y, int verbose) {
+	asid a = asid_new();
+	if (a == NULL) {
+		fprintf(stderr, "out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+	asid_set_sample_rate(a, 48000.f);
+	asid_set_decimation(a, rng_int(0, 1));
+	asid_set_model(a, (asid_model)rng_int(0, asid_model_n - 1));
+	asid_reset(a);
+	const int length = rng_int(1, MAX_LENGTH);
+	random_signal(x, length);
+	if (verbose)
+		printf("untrusted %d: length %d\n", iter, length);
+
+	for (int i = 0; i < length; ) {
+		switch (rng_int(0, 4)) {
+		case 0:
+			asid_set_parameter(a, rng_int(-2, 9), untrusted_float());
+			break;
+		case 1:
+			{
+				unsigned char data[24];
+				for (int j = 0; j < 24; j++)
+					data[j] = (unsigned char)rng();
+				set_state(a, data, rng_int(0, 24));
+			}
+			break;
+		case 2:
+			asid_set_stages(a, rng_int(-2, ASID_STAGES_MAX + 2));
+			break;
+		case 3:
+			{
+				const int k = rng_int(-1, ASID_STAGES_MAX);
+				asid_set_stage_cutoff_offset(a, k, untrusted_float());
+				asid_set_stage_lfo_offset(a, k, untrusted_float());
+				asid_set_stage_mode(a, k, untrusted_float(), untrusted_float(), untrusted_float());
+				asid_set_stage_volume(a, k, untrusted_float());
+			}
+			break;
+		default:
+			(void)asid_get_parameter(a, rng_int(-2, 9));
+		}
+		int n = block_size(480);
+		n = n < length - i ? n : length - i;
+		const float *xp = x + i;
+		float *yp = y + i;
+		asid_process(a, &xp, &yp, n);
+		i += n;
+	}
+	asid_free(a);
+
+	for (int i = 0; i < length; i++)
+		if (!isfinite(y[i])) {
+			fprintf(stderr, "untrusted, iteration %d: non-finite output at sample %d\n", iter, i);
+			return 1;
+		}
+	return 0;
+}
+
+int main(int argc, char** argv) {
+	uint64_t seed = 1;
+	int iterations = 100;
+	int verbose = 0;
+	int opt;
+	while ((opt = getopt(argc, argv, "s:i:v")) != -1)
+		switch (opt) {
+		case 's':
+			seed = strtoull(optarg, NULL, 10);
+			break;
+		case 'i':
+			iterations = atoi(optarg);
+			break;
+		case 'v':
+			verbose = 1;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-s seed] [-i iterations] [-v]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	rng_state = seed * 0x9e3779b97f4a7c15ull + 1;
+
+	static float x[MAX_LENGTH], y_ref[MAX_LENGTH], y[MAX_LENGTH];
+	int failures = 0;
+	for (int i = 0; i < iterations; i++) {
+		failures += check_filter(i, x, y_ref, y, verbose);
+		failures += check_asid(i, x, y_ref, y, verbose);
+		failures += check_sample_rate(i, x, y_ref, y, verbose);
+		failures += check_untrusted(i, x, y, verbose);
+	}
+
+	printf("digest: %016llx\n", (unsigned long long)digest);
+	printf("%d failures in %d iterations\n", failures, iterations);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
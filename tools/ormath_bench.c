@@ -0,0 +1,50 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Array kernels for ormath_report, compiled twice (see Makefile): once with
+// auto-vectorization disabled (BENCH_SCALAR) and once with it enabled.
+
+#include "ormath_bench.h"
+
+#include <math.h>
+
+#include "ormath.h"
+#include "ormath_ref.h"
+
+#ifdef BENCH_SCALAR
+# define KERNEL(name)	bench_scalar_ ## name
+#else
+# define KERNEL(name)	bench_vector_ ## name
+#endif
+
+#define X(name, approx, ref) \
+	void KERNEL(name)(const float *x, float *y, int n) { \
+		for (int i = 0; i < n; i++) { \
+			const float v = x[i]; \
+			y[i] = approx; \
+		} \
+	} \
+	void KERNEL(name ## _libm)(const float *x, float *y, int n) { \
+		for (int i = 0; i < n; i++) { \
+			const float v = x[i]; \
+			y[i] = ref; \
+		} \
+	}
+BENCH_FUNCTIONS
+#undef X
@@ -0,0 +1,44 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#ifndef _ORMATH_BENCH_H
+#define _ORMATH_BENCH_H
+
+// X(name, approximation, libm counterpart), both as expressions of float v
+#define BENCH_FUNCTIONS \
+	X(sinf_3,	ormath_sinf_3(v),	sinf(v)) \
+	X(cosf_3,	ormath_cosf_3(v),	cosf(v)) \
+	X(tanf_div_3,	ormath_tanf_div_3(v),	tanf(v)) \
+	X(tanf_pade_3,	ormath_tanf_pade_3(v),	tanf(v)) \
+	X(log2f_3,	ormath_log2f_3(v),	log2f(v)) \
+	X(logf_3,	ormath_logf_3(v),	logf(v)) \
+	X(omega_3log,	ormath_omega_3log(v),	(float)ormath_omega_ref(v)) \
+	X(truncf,	ormath_truncf(v),	truncf(v)) \
+	X(roundf,	ormath_roundf(v),	roundf(v)) \
+	X(floorf,	ormath_floorf(v),	floorf(v))
+
+#define X(name, approx, ref) \
+	void bench_scalar_ ## name(const float *x, float *y, int n); \
+	void bench_scalar_ ## name ## _libm(const float *x, float *y, int n); \
+	void bench_vector_ ## name(const float *x, float *y, int n); \
+	void bench_vector_ ## name ## _libm(const float *x, float *y, int n);
+BENCH_FUNCTIONS
+#undef X
+
+#endif
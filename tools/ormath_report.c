@@ -0,0 +1,418 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ *
+ * Accuracy and speed report for the approximations in ormath.h, against libm
+ * (and ormath_omega_ref() for omega) over their operating ranges in the
+ * engine, plus end-to-end error of ordsp_mos_8580_filter in fast and balanced
+ * quality against reference quality, and cost of the nonlinear integrator
+ * model against the linear one.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ormath.h"
+#include "ormath_ref.h"
+#include "ormath_bench.h"
+#include "mos_8580_filter.h"
+
+typedef void (*kernel)(const float *x, float *y, int n);
+
+typedef struct {
+	const char	*name;
+	float		(*approx)(float);
+	double		(*ref)(double);
+	double		 lo, hi;
+	char		 log_spaced;
+	const char	*note;
+	kernel		 scalar, vector, scalar_libm, vector_libm;
+} function;
+
+typedef struct {
+	const char	*name;
+	float		(*approx)(float);
+	double		(*ref)(double);
+	const char	*note;
+	kernel		 scalar, vector, scalar_libm, vector_libm;
+} rounding;
+
+#define KERNELS(name) bench_scalar_ ## name, bench_vector_ ## name, bench_scalar_ ## name ## _libm, bench_vector_ ## name ## _libm
+
+static const function functions[] = {
+	{ "sinf_3",	ormath_sinf_3,		sin,			-M_PI,		M_PI,		0, "",						KERNELS(sinf_3) },
+	{ "cosf_3",	ormath_cosf_3,		cos,			-M_PI,		M_PI,		0, "",						KERNELS(cosf_3) },
+	{ "tanf_div_3",	ormath_tanf_div_3,	tan,			0.0,		1.2,		0, "pi fc / fs, 50e3 / fs for fs >= 44.1 kHz",	KERNELS(tanf_div_3) },
+	{ "tanf_div_3",	ormath_tanf_div_3,	tan,			-1.5,		1.5,		0, "",						KERNELS(tanf_div_3) },
+	{ "tanf_pade_3",	ormath_tanf_pade_3,	tan,			0.0,		1.2,		0, "fast tier",					KERNELS(tanf_pade_3) },
+	{ "log2f_3",	ormath_log2f_3,		log2,			0x1p-20,	0x1p20,		1, "",						KERNELS(log2f_3) },
+	{ "logf_3",	ormath_logf_3,		log,			8.0,		512.0,		0, "omega_3log large argument branch",	KERNELS(logf_3) },
+	{ "omega_3log",	ormath_omega_3log,	ormath_omega_ref,	-30.0,		330.0,		0, "output buffer, 38.46 Vb + 159.69",	KERNELS(omega_3log) },
+	{ "omega_3log",	ormath_omega_3log,	ormath_omega_ref,	-3.34,		8.0,		0, "polynomial branch",			KERNELS(omega_3log) }
+};
+
+static const rounding roundings[] = {
+	{ "truncf",	ormath_truncf,		trunc,		"",				KERNELS(truncf) },
+	{ "roundf",	ormath_roundf,		round,		"half away from zero",		KERNELS(roundf) },
+	{ "floorf",	ormath_floorf,		floor,		"",				KERNELS(floorf) }
+};
+
+#define N_FUNCTIONS	(sizeof(functions) / sizeof(function))
+#define N_ROUNDINGS	(sizeof(roundings) / sizeof(rounding))
+#define BENCH_N		4096
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// distance in float ulps at the reference value
+static double ulps(float a, double r) {
+	const float rf = (float)r;
+	const float u = nextafterf(fabsf(rf), INFINITY) - fabsf(rf);
+	return fabs((double)a - r) / u;
+}
+
+// millions of evaluations per second
+static double throughput(kernel k, const float *x, float *y, double min_time) {
+	int reps = 1;
+	while (1) {
+		const double t0 = now();
+		for (int r = 0; r < reps; r++)
+			k(x, y, BENCH_N);
+		const double t = now() - t0;
+		if (t >= min_time)
+			return 1e-6 * reps * BENCH_N / t;
+		reps *= 2;
+	}
+}
+
+static void report_speed(kernel s, kernel v, kernel sl, kernel vl, const float *x, double min_time) {
+	static float y[BENCH_N];
+	printf("  speed (M/s): scalar %8.1f  vector %8.1f  | libm scalar %8.1f  vector %8.1f\n",
+		throughput(s, x, y, min_time), throughput(v, x, y, min_time),
+		throughput(sl, x, y, min_time), throughput(vl, x, y, min_time));
+}
+
+static void report_function(const function *f, long n, double min_time) {
+	double max_abs = 0.0, max_rel = 0.0, max_ulps = 0.0, mean_abs = 0.0;
+	double at_abs = f->lo, at_rel = f->lo;
+	for (long i = 0; i < n; i++) {
+		const double u = (double)i / (double)(n - 1);
+		const float x = (float)(f->log_spaced ? f->lo * pow(f->hi / f->lo, u) : f->lo + (f->hi - f->lo) * u);
+		const double r = f->ref(x);
+		const float a = f->approx(x);
+		const double e = fabs((double)a - r);
+		mean_abs += e;
+		if (e > max_abs) {
+			max_abs = e;
+			at_abs = x;
+		}
+		if (fabs(r) > 1e-30 && e / fabs(r) > max_rel) {
+			max_rel = e / fabs(r);
+			at_rel = x;
+		}
+		const double ul = ulps(a, r);
+		if (ul > max_ulps)
+			max_ulps = ul;
+	}
+
+	printf("%s [%g, %g]%s%s\n", f->name, f->lo, f->hi, *f->note ? " - " : "", f->note);
+	printf("  max abs err %.3e (x = %g)  mean abs err %.3e\n", max_abs, at_abs, mean_abs / n);
+	printf("  max rel err %.3e (x = %g)  max ulps %.0f\n", max_rel, at_rel, max_ulps);
+
+	static float x[BENCH_N];
+	for (int i = 0; i < BENCH_N; i++) {
+		const double u = (double)i / (BENCH_N - 1);
+		x[i] = (float)(f->log_spaced ? f->lo * pow(f->hi / f->lo, u) : f->lo + (f->hi - f->lo) * u);
+	}
+	report_speed(f->scalar, f->vector, f->scalar_libm, f->vector_libm, x, min_time);
+}
+
+// all float bit patterns up to |x| = 2^25 (beyond that every float is an
+// integer), in steps of stride
+static void report_rounding(const rounding *f, uint32_t stride, double min_time) {
+	uint64_t checked = 0, wrong = 0;
+	float first_wrong = 0.f;
+	for (uint64_t b = 0; b <= 0x4c000000u; b += stride)
+		for (int s = 0; s < 2; s++) {
+			const uint32_t bits = (uint32_t)b | (s ? 0x80000000u : 0);
+			float x;
+			memcpy(&x, &bits, 4);
+			const float a = f->approx(x);
+			const float r = (float)f->ref(x);
+			checked++;
+			// -0 vs +0 is fine, but sign is checked otherwise
+			if (a != r) {
+				if (wrong == 0)
+					first_wrong = x;
+				wrong++;
+			}
+		}
+
+	printf("%s [-2^25, 2^25]%s%s\n", f->name, *f->note ? " - " : "", f->note);
+	if (wrong)
+		printf("  %llu of %llu values differ from libm (first at x = %.9g)\n", (unsigned long long)wrong, (unsigned long long)checked, first_wrong);
+	else
+		printf("  exact on all %llu values checked\n", (unsigned long long)checked);
+
+	static float x[BENCH_N];
+	for (int i = 0; i < BENCH_N; i++)
+		x[i] = -100.f + 200.f * i / (BENCH_N - 1);
+	report_speed(f->scalar, f->vector, f->scalar_libm, f->vector_libm, x, min_time);
+}
+
+static const char *quality_names[] = { "fast", "balanced", "reference" };
+
+static void report_filter(float fs, double min_time) {
+	const int n = (int)fs;
+	float *x = (float *)malloc(n * sizeof(float));
+	float *y[3];
+	ordsp_mos_8580_filter f[3];
+	for (int k = 0; k < 3; k++) {
+		y[k] = (float *)malloc(n * sizeof(float));
+		f[k] = ordsp_mos_8580_filter_new();
+		if (!x || !y[k] || !f[k]) {
+			fprintf(stderr, "Out of memory\n");
+			exit(1);
+		}
+		// indices are quality values
+		ordsp_mos_8580_filter_set_quality(f[k], (ordsp_mos_8580_filter_quality)k);
+		ordsp_mos_8580_filter_set_sample_rate(f[k], fs);
+	}
+	const int ref = ordsp_mos_8580_filter_quality_reference;
+
+	static const char *signals[] = { "log sweep 20 Hz - 20 kHz, amp 1", "white noise, amp 1", "1 kHz sine, amp 4 (clipping)" };
+	static const struct { const char *name; float lp, bp, hp; } modes[] = { { "bp", 0.f, 1.f, 0.f }, { "lp", 1.f, 0.f, 0.f }, { "hp", 0.f, 0.f, 1.f } };
+	static const int resonances[] = { 0, 8, 15 };
+
+	printf("mos_8580_filter vs reference quality, fs = %g Hz, 1 s per run, cutoff 0:128:2047, resonance 0/8/15, volume 15\n", fs);
+	for (int s = 0; s < 3; s++) {
+		uint32_t seed = 1;
+		for (int i = 0; i < n; i++)
+			if (s == 0) {
+				const double L = n / log(1e3);
+				x[i] = (float)sin(2.0 * M_PI * 20.0 / fs * L * (exp(i / L) - 1.0));
+			} else if (s == 1) {
+				seed = seed * 1664525u + 1013904223u;
+				x[i] = (float)seed * (2.f / 4294967296.f) - 1.f;
+			} else
+				x[i] = 4.f * sinf(2.f * (float)M_PI * 1e3f / fs * i);
+
+		for (int m = 0; m < 3; m++) {
+			double worst_abs[2] = { 0.0, 0.0 }, worst_snr[2] = { INFINITY, INFINITY };
+			int worst_c[2] = { 0, 0 }, worst_q[2] = { 0, 0 };
+			for (int q = 0; q < 3; q++)
+				for (int c = 0; c < 2048; c += 128) {
+					for (int k = 0; k < 3; k++) {
+						ordsp_mos_8580_filter_set_mode(f[k], 0.f, modes[m].lp, modes[m].bp, modes[m].hp);
+						ordsp_mos_8580_filter_set_cutoff(f[k], c / 2047.f);
+						ordsp_mos_8580_filter_set_resonance(f[k], resonances[q] / 15.f);
+						ordsp_mos_8580_filter_set_volume(f[k], 1.f);
+						ordsp_mos_8580_filter_reset(f[k]);
+						ordsp_mos_8580_filter_process(f[k], x, y[k], n);
+					}
+					for (int k = 0; k < 2; k++) {
+						double e2 = 0.0, r2 = 0.0, ea = 0.0;
+						for (int i = 0; i < n; i++) {
+							const double e = (double)y[k][i] - y[ref][i];
+							e2 += e * e;
+							r2 += (double)y[ref][i] * y[ref][i];
+							if (fabs(e) > ea)
+								ea = fabs(e);
+						}
+						const double snr = r2 > 0.0 ? 10.0 * log10(r2 / (e2 > 0.0 ? e2 : 1e-300)) : INFINITY;
+						if (ea > worst_abs[k])
+							worst_abs[k] = ea;
+						if (snr < worst_snr[k]) {
+							worst_snr[k] = snr;
+							worst_c[k] = c;
+							worst_q[k] = resonances[q];
+						}
+					}
+				}
+			for (int k = 0; k < 2; k++)
+				printf("  %-32s %s %-8s: max abs err %.3e V, worst SNR %6.1f dB (cutoff %d, resonance %d)\n", signals[s], modes[m].name, quality_names[k], worst_abs[k], worst_snr[k], worst_c[k], worst_q[k]);
+		}
+	}
+
+	// speed on noise, bp, middle settings
+	printf("  speed (M samples/s):");
+	for (int k = 0; k < 3; k++) {
+		ordsp_mos_8580_filter_set_mode(f[k], 0.f, 0.f, 1.f, 0.f);
+		ordsp_mos_8580_filter_set_cutoff(f[k], 0.5f);
+		ordsp_mos_8580_filter_set_resonance(f[k], 0.5f);
+		ordsp_mos_8580_filter_reset(f[k]);
+		int reps = 1;
+		double sps;
+		while (1) {
+			const double t0 = now();
+			for (int r = 0; r < reps; r++)
+				ordsp_mos_8580_filter_process(f[k], x, y[k], n);
+			const double t = now() - t0;
+			if (t >= min_time) {
+				sps = (double)reps * n / t;
+				break;
+			}
+			reps *= 2;
+		}
+		printf(" %s %.1f (%.0fx realtime)", quality_names[k], 1e-6 * sps, sps / fs);
+	}
+	printf("\n");
+
+	for (int k = 0; k < 3; k++) {
+		ordsp_mos_8580_filter_free(f[k]);
+		free(y[k]);
+	}
+	free(x);
+}
+
+// Cost of the nonlinear integrators relative to the linear model. The solver
+// runs a fixed number of Newton iterations without branches, so the cost should
+// not depend on the signal: this checks it on a typical case and on the worst
+// one for convergence (loud noise, cutoff all the way up, full resonance).
+
+#define NL_MAX_COST	8.0	// stated bound, nonlinear / linear time
+
+static double filter_speed(ordsp_mos_8580_filter f, const float *x, float *y, int n, double min_time) {
+	ordsp_mos_8580_filter_reset(f);
+	int reps = 1;
+	while (1) {
+		const double t0 = now();
+		for (int r = 0; r < reps; r++)
+			ordsp_mos_8580_filter_process(f, x, y, n);
+		const double t = now() - t0;
+		if (t >= min_time)
+			return (double)reps * n / t;
+		reps *= 2;
+	}
+}
+
+static void report_filter_nonlinear(float fs, double min_time) {
+	const int n = (int)fs;
+	float *x = (float *)malloc(n * sizeof(float));
+	float *y = (float *)malloc(n * sizeof(float));
+	float *y_ref = (float *)malloc(n * sizeof(float));
+	ordsp_mos_8580_filter f = ordsp_mos_8580_filter_new();
+	ordsp_mos_8580_filter f_ref = ordsp_mos_8580_filter_new();
+	if (!x || !y || !y_ref || !f || !f_ref) {
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	}
+	ordsp_mos_8580_filter_set_sample_rate(f, fs);
+	ordsp_mos_8580_filter_set_sample_rate(f_ref, fs);
+	ordsp_mos_8580_filter_set_quality(f_ref, ordsp_mos_8580_filter_quality_reference);
+	ordsp_mos_8580_filter_set_nonlinear(f_ref, 1);
+
+	static const struct { const char *name; float amp, cutoff, resonance; } cases[] = {
+		{ "typical (noise amp 1, cutoff 1024, resonance 8)", 1.f, 0.5f, 8.f / 15.f },
+		{ "worst (noise amp 4, cutoff 2047, resonance 15)", 4.f, 1.f, 1.f }
+	};
+
+	printf("mos_8580_filter nonlinear integrators, fs = %g Hz, bp, volume 15\n", fs);
+	double worst = 0.0;
+	for (int c = 0; c < 2; c++) {
+		uint32_t seed = 1;
+		for (int i = 0; i < n; i++) {
+			seed = seed * 1664525u + 1013904223u;
+			x[i] = cases[c].amp * ((float)seed * (2.f / 4294967296.f) - 1.f);
+		}
+		ordsp_mos_8580_filter fs_[2] = { f, f_ref };
+		for (int k = 0; k < 2; k++) {
+			ordsp_mos_8580_filter_set_mode(fs_[k], 0.f, 0.f, 1.f, 0.f);
+			ordsp_mos_8580_filter_set_cutoff(fs_[k], cases[c].cutoff);
+			ordsp_mos_8580_filter_set_resonance(fs_[k], cases[c].resonance);
+			ordsp_mos_8580_filter_set_volume(fs_[k], 1.f);
+		}
+		ordsp_mos_8580_filter_reset(f_ref);
+		ordsp_mos_8580_filter_process(f_ref, x, y_ref, n);
+
+		printf("  %s\n", cases[c].name);
+		for (int q = 0; q < 3; q++) {
+			ordsp_mos_8580_filter_set_quality(f, (ordsp_mos_8580_filter_quality)q);
+			ordsp_mos_8580_filter_set_nonlinear(f, 0);
+			const double lin = filter_speed(f, x, y, n, min_time);
+			ordsp_mos_8580_filter_set_nonlinear(f, 1);
+			const double nl = filter_speed(f, x, y, n, min_time);
+
+			ordsp_mos_8580_filter_reset(f);
+			ordsp_mos_8580_filter_process(f, x, y, n);
+			double e2 = 0.0, r2 = 0.0;
+			for (int i = 0; i < n; i++) {
+				const double e = (double)y[i] - y_ref[i];
+				e2 += e * e;
+				r2 += (double)y_ref[i] * y_ref[i];
+			}
+
+			const double cost = lin / nl;
+			if (cost > worst)
+				worst = cost;
+			printf("    %-9s linear %6.1f, nonlinear %6.1f M samples/s (%.2fx cost)", quality_names[q], 1e-6 * lin, 1e-6 * nl, cost);
+			if (q != ordsp_mos_8580_filter_quality_reference)
+				printf(", SNR vs reference %6.1f dB", e2 > 0.0 ? 10.0 * log10(r2 / e2) : INFINITY);
+			printf("\n");
+		}
+	}
+	printf("  worst cost %.2fx, bound %.1fx: %s\n", worst, NL_MAX_COST, worst <= NL_MAX_COST ? "ok" : "EXCEEDED");
+
+	ordsp_mos_8580_filter_free(f);
+	ordsp_mos_8580_filter_free(f_ref);
+	free(x);
+	free(y);
+	free(y_ref);
+}
+
+int main(int argc, char **argv) {
+	long n = 1000000;
+	uint32_t stride = 61;
+	double min_time = 0.2;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			n = atol(argv[++i]);
+		else if (strcmp(argv[i], "-x") == 0)
+			stride = 1;
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			min_time = atof(argv[++i]);
+		else {
+			fprintf(stderr,
+				"Usage: %s [-n POINTS] [-x] [-t SECONDS]\n"
+				"  -n POINTS   points per function accuracy sweep (default 1000000)\n"
+				"  -x          check rounding functions exhaustively (default every 61st float)\n"
+				"  -t SECONDS  minimum time per speed measurement (default 0.2)\n",
+				argv[0]);
+			return 1;
+		}
+	}
+	if (n < 2)
+		n = 2;
+
+	for (size_t i = 0; i < N_FUNCTIONS; i++)
+		report_function(functions + i, n, min_time);
+	for (size_t i = 0; i < N_ROUNDINGS; i++)
+		report_rounding(roundings + i, stride, min_time);
+	report_filter(48e3f, min_time);
+	report_filter(192e3f, min_time);
+	report_filter_nonlinear(48e3f, min_time);
+	report_filter_nonlinear(192e3f, min_time);
+
+	return 0;
+}
@@ -0,0 +1,694 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ *
+ * Log-sweep measurement of ordsp_mos_8580_filter over a grid of cutoff,
+ * resonance, and sample rate settings. Same sweep and inverse filter as
+ * octave/getIR.m, based on
+ *
+ * A.Farina, "Simultaneous measurement of impulse response and distortion with
+ * a swept-sine technique", 108th AES Convention, Paris, France, February 2000.
+ *
+ * Output file format (all little endian):
+ *
+ *   header:
+ *     char[4]   magic "ASIR"
+ *     uint32    version (2, 1 had padding in place of nonlinear)
+ *     uint32    number of records
+ *     uint32    number of harmonics (K, 1 = linear response only)
+ *     uint32    harmonic window length (W, power of 2)
+ *     uint32    IR pre-delay (samples before t = 0 in each IR)
+ *     float32   sweep amplitude
+ *     uint8     mode (bit 0 = lp, bit 1 = bp, bit 2 = hp)
+ *     uint8     quality (0 = balanced, 1 = reference)
+ *     uint8     nonlinear integrators (0 = off, 1 = on)
+ *     uint8     padding
+ *
+ *   record (one per setting, sample rate slowest, then resonance, then cutoff):
+ *     float32   sample rate (Hz)
+ *     uint16    cutoff (register value, 0 to 2047)
+ *     uint8     resonance (register value, 0 to 15)
+ *     uint8     padding
+ *     uint32    IR length (N, proportional to sample rate)
+ *     float32   IR[N]
+ *     float32   spectra[K][W / 2 + 1]
+ *
+ * spectra[k - 1][b] is the magnitude of the k-th harmonic IR at output
+ * frequency b * fs / W, i.e., the response to input frequency b * fs / (k W).
+ * THD per harmonic is spectra[k - 1][k b] / spectra[0][b].
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "fft.h"
+#include "mos_8580_filter.h"
+
+#define MAX_SAMPLE_RATES	16
+#define MAX_THREADS		256
+
+typedef struct {
+	// options
+	float		 sample_rates[MAX_SAMPLE_RATES];
+	int		 n_sample_rates;
+	int		 cutoff_first, cutoff_step, cutoff_last;
+	int		 resonance_first, resonance_step, resonance_last;
+	double		 f_start, f_end;
+	double		 length;		// s
+	double		 silence;		// s
+	double		 ir_length;		// s
+	int		 ir_pre;		// samples
+	int		 n_harmonics;
+	int		 window;		// samples
+	float		 amplitude;
+	int		 mode;
+	int		 quality;
+	int		 nonlinear;
+	int		 n_threads;
+
+	// grid
+	int		 n_cutoffs;
+	int		 n_resonances;
+	int		 n_records;
+} options;
+
+// per sample rate, shared read-only by workers
+typedef struct {
+	float		 fs;
+	int		 t1, t2, t3;		// sweep start, end, total length
+	double		 L;
+	float		*sweep;			// t3 samples
+	fft		 conv;
+	double complex	*inv;			// inverse filter spectrum, normalized
+	int		 n0;			// index of t = 0 in deconvolved output
+	int		 ir_n;
+} rate_data;
+
+typedef struct {
+	const options	*opts;
+	const rate_data	*rates;
+	float		**records;		// payload of each record (IR + spectra)
+	pthread_mutex_t	 lock;
+	int		 next;
+	int		 done;
+	int		 failed;
+} job;
+
+static const char *mode_names[] = { "off", "lp", "bp", "lp+bp", "hp", "lp+hp", "bp+hp", "lp+bp+hp" };
+
+static int parse_range(const char *s, int *first, int *step, int *last, int max) {
+	int a, b, c;
+	char t;
+	if (sscanf(s, "%d:%d:%d%c", &a, &b, &c, &t) == 3)
+		;
+	else if (sscanf(s, "%d%c", &a, &t) == 1) {
+		b = 1;
+		c = a;
+	} else
+		return -1;
+	if (a < 0 || c > max || a > c || b < 1)
+		return -1;
+	*first = a;
+	*step = b;
+	*last = c;
+	return 0;
+}
+
+static int parse_rates(const char *s, options *o) {
+	o->n_sample_rates = 0;
+	while (*s) {
+		char *e;
+		const double v = strtod(s, &e);
+		if (e == s || v < 8e3 || v > 1536e3 || o->n_sample_rates == MAX_SAMPLE_RATES)
+			return -1;
+		o->sample_rates[o->n_sample_rates++] = (float)v;
+		s = e;
+		if (*s == ',')
+			s++;
+		else if (*s)
+			return -1;
+	}
+	return o->n_sample_rates ? 0 : -1;
+}
+
+static int parse_mode(const char *s) {
+	for (int i = 1; i < 8; i++)
+		if (strcmp(s, mode_names[i]) == 0)
+			return i;
+	return -1;
+}
+
+static size_t next_pow2(size_t n) {
+	size_t p = 4;
+	while (p < n)
+		p <<= 1;
+	return p;
+}
+
+static size_t record_size(const options *o, const rate_data *r) {
+	return (size_t)r->ir_n + (size_t)o->n_harmonics * (o->window / 2 + 1);
+}
+
+static void rate_data_free(rate_data *r) {
+	free(r->sweep);
+	free(r->inv);
+	if (r->conv)
+		fft_free(r->conv);
+}
+
+// Band where the sweep has full energy, one octave in from each end, and not
+// below n bins of width fs / n (so that windows of n samples resolve it)
+static void norm_band(const options *o, size_t n, float fs, double *f1, double *f2) {
+	*f1 = 2.0 * o->f_start;
+	if (*f1 < 4.0 * fs / n)
+		*f1 = 4.0 * fs / n;
+	*f2 = 0.5 * o->f_end;
+	if (*f2 <= *f1) {
+		*f1 = o->f_start;
+		*f2 = o->f_end;
+	}
+}
+
+static int rate_data_init(rate_data *r, const options *o, float fs) {
+	memset(r, 0, sizeof(rate_data));
+	r->fs = fs;
+	r->t1 = (int)round(fs * o->silence);
+	r->t2 = (int)round(o->length * fs + o->silence * fs);
+	r->t3 = (int)round(o->length * fs + 2.0 * o->silence * fs);
+	r->ir_n = (int)round(o->ir_length * fs);
+
+	const int n = r->t2 - r->t1;
+	const double w1 = 2.0 * M_PI * o->f_start / fs;
+	const double w2 = 2.0 * M_PI * o->f_end / fs;
+	const double K = n * w1 / log(w2 / w1);
+	r->L = n / log(w2 / w1);
+
+	// Linear response at n0 = t1 + t2 - 1, k-th harmonic L log(k) earlier.
+	// Circular convolution must not wrap anything we extract.
+	r->n0 = r->t1 + r->t2 - 1;
+	const size_t N = next_pow2((size_t)(2 * r->t3));
+	if (r->n0 - o->ir_pre - (int)round(r->L * log((double)o->n_harmonics)) < 0
+	    || (size_t)(r->n0 - o->ir_pre + (r->ir_n > o->window ? r->ir_n : o->window)) > N)
+		return -1;
+
+	r->sweep = (float *)calloc(r->t3, sizeof(float));
+	double *inv = (double *)calloc(N, sizeof(double));
+	r->inv = (double complex *)malloc((N / 2 + 1) * sizeof(double complex));
+	r->conv = fft_new(N);
+	if (!r->sweep || !inv || !r->inv || !r->conv) {
+		free(inv);
+		return -1;
+	}
+
+	for (int t = 0; t < n; t++)
+		r->sweep[r->t1 + t] = (float)sin(K * (exp(t / r->L) - 1.0));
+	for (int t = 0; t < n; t++) {
+		const double w = w1 * exp(t / (double)n * log(w2 / w1));
+		const double env = pow(10.0, -6.0 / 20.0 * log2(w / w1));
+		inv[r->t1 + t] = r->sweep[r->t2 - 1 - t] * env;
+	}
+
+	// Normalize so that sweep and inverse filter convolve to unity gain within
+	// the band, away from the ripple at its edges. Normalizing the peak of the
+	// deconvolved sweep instead would be off by about (f_end - f_start) / (fs /
+	// 2), as it is band-limited.
+	fft_forward(r->conv, inv, r->inv);
+	for (size_t i = 0; i < N; i++)
+		inv[i] = i < (size_t)r->t3 ? r->sweep[i] : 0.0;
+	double complex *S = (double complex *)malloc((N / 2 + 1) * sizeof(double complex));
+	if (S == NULL) {
+		free(inv);
+		return -1;
+	}
+	fft_forward(r->conv, inv, S);
+	double f1, f2;
+	norm_band(o, N, fs, &f1, &f2);
+	const size_t b1 = (size_t)ceil(f1 * N / fs);
+	const size_t b2 = (size_t)floor(f2 * N / fs);
+	double gain = 0.0;
+	for (size_t b = b1; b <= b2; b++)
+		gain += cabs(S[b] * r->inv[b]);
+	gain /= (double)(b2 - b1 + 1);
+	for (size_t b = 0; b <= N / 2; b++)
+		r->inv[b] /= gain * o->amplitude;
+	free(S);
+	free(inv);
+	return 0;
+}
+
+// f = NULL measures a unity gain system, see check_unity()
+static int measure(const options *o, const rate_data *r, int cutoff, int resonance, ordsp_mos_8580_filter f, fft conv, fft win, float *x, double *h, double complex *H, double *w, double complex *Wf, float *out) {
+	for (int i = 0; i < r->t3; i++)
+		x[i] = o->amplitude * r->sweep[i];
+	if (f != NULL) {
+		ordsp_mos_8580_filter_set_sample_rate(f, r->fs);
+		ordsp_mos_8580_filter_set_mode(f, 0.f, o->mode & 1 ? 1.f : 0.f, o->mode & 2 ? 1.f : 0.f, o->mode & 4 ? 1.f : 0.f);
+		ordsp_mos_8580_filter_set_cutoff(f, (1.f / 2047.f) * cutoff);
+		ordsp_mos_8580_filter_set_resonance(f, (1.f / 15.f) * resonance);
+		ordsp_mos_8580_filter_set_volume(f, 1.f);
+		ordsp_mos_8580_filter_set_quality(f, o->quality ? ordsp_mos_8580_filter_quality_reference : ordsp_mos_8580_filter_quality_balanced);
+		ordsp_mos_8580_filter_set_nonlinear(f, o->nonlinear);
+		ordsp_mos_8580_filter_reset(f);
+		ordsp_mos_8580_filter_process(f, x, x, r->t3);
+	}
+
+	const size_t N = fft_get_size(conv);
+	for (int i = 0; i < r->t3; i++)
+		h[i] = x[i];
+	memset(h + r->t3, 0, (N - r->t3) * sizeof(double));
+	fft_forward(conv, h, H);
+	for (size_t i = 0; i <= N / 2; i++)
+		H[i] *= r->inv[i];
+	fft_inverse(conv, H, h);
+
+	const int start = r->n0 - o->ir_pre;
+	for (int i = 0; i < r->ir_n; i++)
+		out[i] = (float)h[start + i];
+	out += r->ir_n;
+
+	const int W = o->window;
+	for (int k = 1; k <= o->n_harmonics; k++) {
+		const int s = start - (int)round(r->L * log((double)k));
+		for (int i = 0; i < W; i++)
+			w[i] = h[s + i];
+		fft_forward(win, w, Wf);
+		for (int b = 0; b <= W / 2; b++)
+			out[b] = (float)cabs(Wf[b]);
+		out += W / 2 + 1;
+	}
+	return 0;
+}
+
+static void *worker(void *data) {
+	job *j = (job *)data;
+	const options *o = j->opts;
+
+	size_t max_t3 = 0, max_N = 0;
+	for (int i = 0; i < o->n_sample_rates; i++) {
+		if ((size_t)j->rates[i].t3 > max_t3)
+			max_t3 = j->rates[i].t3;
+		if (fft_get_size(j->rates[i].conv) > max_N)
+			max_N = fft_get_size(j->rates[i].conv);
+	}
+
+	ordsp_mos_8580_filter f = ordsp_mos_8580_filter_new();
+	fft win = fft_new(o->window);
+	float *x = (float *)malloc(max_t3 * sizeof(float));
+	double *h = (double *)malloc(max_N * sizeof(double));
+	double complex *H = (double complex *)malloc((max_N / 2 + 1) * sizeof(double complex));
+	double *w = (double *)malloc(o->window * sizeof(double));
+	double complex *Wf = (double complex *)malloc((o->window / 2 + 1) * sizeof(double complex));
+	fft conv[MAX_SAMPLE_RATES];
+	char ok = f && win && x && h && H && w && Wf;
+	// fft instances hold scratch memory, hence one per worker
+	for (int i = 0; i < o->n_sample_rates; i++) {
+		conv[i] = ok ? fft_new(fft_get_size(j->rates[i].conv)) : NULL;
+		ok = ok && conv[i];
+	}
+
+	const int per_rate = o->n_cutoffs * o->n_resonances;
+	while (1) {
+		pthread_mutex_lock(&j->lock);
+		if (!ok)
+			j->failed = 1;
+		const int n = j->failed ? o->n_records : j->next++;
+		pthread_mutex_unlock(&j->lock);
+		if (n >= o->n_records)
+			break;
+
+		const int ri = n / per_rate;
+		const int c = o->cutoff_first + o->cutoff_step * (n % o->n_cutoffs);
+		const int q = o->resonance_first + o->resonance_step * ((n % per_rate) / o->n_cutoffs);
+		measure(o, j->rates + ri, c, q, f, conv[ri], win, x, h, H, w, Wf, j->records[n]);
+
+		pthread_mutex_lock(&j->lock);
+		j->done++;
+		if (j->done % 64 == 0 || j->done == o->n_records)
+			fprintf(stderr, "\r%d/%d", j->done, o->n_records);
+		pthread_mutex_unlock(&j->lock);
+	}
+
+	for (int i = 0; i < o->n_sample_rates; i++)
+		if (conv[i])
+			fft_free(conv[i]);
+	free(Wf);
+	free(w);
+	free(H);
+	free(h);
+	free(x);
+	if (win)
+		fft_free(win);
+	if (f)
+		ordsp_mos_8580_filter_free(f);
+	return NULL;
+}
+
+// Measures a unity gain system at each sample rate: its linear response must
+// come out at 0 dB within the normalization band
+#define UNITY_TOLERANCE_DB	0.25
+
+static int check_unity(const options *o, rate_data *rates) {
+	int err = 0;
+	for (int i = 0; i < o->n_sample_rates && !err; i++) {
+		rate_data *r = rates + i;
+		const size_t N = fft_get_size(r->conv);
+		fft win = fft_new(o->window);
+		float *x = (float *)malloc(r->t3 * sizeof(float));
+		double *h = (double *)malloc(N * sizeof(double));
+		double complex *H = (double complex *)malloc((N / 2 + 1) * sizeof(double complex));
+		double *w = (double *)malloc(o->window * sizeof(double));
+		double complex *Wf = (double complex *)malloc((o->window / 2 + 1) * sizeof(double complex));
+		float *out = (float *)malloc(record_size(o, r) * sizeof(float));
+		if (win && x && h && H && w && Wf && out) {
+			measure(o, r, 0, 0, NULL, r->conv, win, x, h, H, w, Wf, out);
+			double f1, f2;
+			norm_band(o, o->window, r->fs, &f1, &f2);
+			const int b1 = (int)ceil(f1 * o->window / r->fs);
+			const int b2 = (int)floor(f2 * o->window / r->fs);
+			double dev = 0.0;
+			for (int b = b1; b <= b2; b++) {
+				const double d = fabs(20.0 * log10(out[r->ir_n + b]));
+				if (!(d <= dev))
+					dev = d;
+			}
+			printf("unity gain at %g Hz: %.4f dB max deviation in %g-%g Hz\n", r->fs, dev, f1, f2);
+			err = !(dev <= UNITY_TOLERANCE_DB);
+		} else {
+			fprintf(stderr, "Out of memory\n");
+			err = 1;
+		}
+		free(out);
+		free(Wf);
+		free(w);
+		free(H);
+		free(h);
+		free(x);
+		if (win)
+			fft_free(win);
+	}
+	return err;
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+	p[0] = v;
+	p[1] = v >> 8;
+	p[2] = v >> 16;
+	p[3] = v >> 24;
+}
+
+static void put_f32(uint8_t *p, float v) {
+	uint32_t u;
+	memcpy(&u, &v, 4);
+	put_u32(p, u);
+}
+
+static int write_floats(FILE *fp, const float *v, size_t n) {
+	uint8_t buf[4096];
+	while (n) {
+		const size_t m = n < sizeof(buf) / 4 ? n : sizeof(buf) / 4;
+		for (size_t i = 0; i < m; i++)
+			put_f32(buf + 4 * i, v[i]);
+		if (fwrite(buf, 4, m, fp) != m)
+			return -1;
+		v += m;
+		n -= m;
+	}
+	return 0;
+}
+
+static int write_output(const char *path, const options *o, const rate_data *rates, float **records) {
+	FILE *fp = fopen(path, "wb");
+	if (fp == NULL)
+		return -1;
+
+	uint8_t hdr[32];
+	memcpy(hdr, "ASIR", 4);
+	put_u32(hdr + 4, 2);
+	put_u32(hdr + 8, o->n_records);
+	put_u32(hdr + 12, o->n_harmonics);
+	put_u32(hdr + 16, o->window);
+	put_u32(hdr + 20, o->ir_pre);
+	put_f32(hdr + 24, o->amplitude);
+	hdr[28] = o->mode;
+	hdr[29] = o->quality;
+	hdr[30] = o->nonlinear;
+	hdr[31] = 0;
+	int err = fwrite(hdr, 1, 32, fp) != 32;
+
+	const int per_rate = o->n_cutoffs * o->n_resonances;
+	for (int n = 0; n < o->n_records && !err; n++) {
+		const rate_data *r = rates + n / per_rate;
+		const int c = o->cutoff_first + o->cutoff_step * (n % o->n_cutoffs);
+		const int q = o->resonance_first + o->resonance_step * ((n % per_rate) / o->n_cutoffs);
+		uint8_t rh[12];
+		put_f32(rh, r->fs);
+		rh[4] = c;
+		rh[5] = c >> 8;
+		rh[6] = q;
+		rh[7] = 0;
+		put_u32(rh + 8, r->ir_n);
+		err = fwrite(rh, 1, 12, fp) != 12 || write_floats(fp, records[n], record_size(o, r));
+	}
+
+	if (fclose(fp))
+		err = 1;
+	return err ? -1 : 0;
+}
+
+static void usage(const char *argv0) {
+	fprintf(stderr,
+		"Usage: %s [options] output_file\n"
+		"       %s [options] -C\n"
+		"\n"
+		"Options:\n"
+		"  -r RATES     comma-separated sample rates in Hz (default 48000)\n"
+		"  -c RANGE     cutoff register values, first:step:last (default 0:1:2047)\n"
+		"  -q RANGE     resonance register values, first:step:last (default 0:15:15)\n"
+		"  -m MODE      lp, bp, hp, or any combination joined by + (default bp)\n"
+		"  -a AMP       sweep amplitude (default 1)\n"
+		"  -T SECONDS   sweep length (default 2)\n"
+		"  -s SECONDS   silence before and after the sweep (default 0.5)\n"
+		"  -f LOW:HIGH  sweep frequency range in Hz (default 20:20000)\n"
+		"  -l SECONDS   IR length (default 0.1)\n"
+		"  -p SAMPLES   IR pre-delay (default 32)\n"
+		"  -k N         number of harmonics, including the fundamental (default 5)\n"
+		"  -w SAMPLES   harmonic window length, power of 2 (default 2048)\n"
+		"  -R           use reference quality (exact math functions)\n"
+		"  -N           use nonlinear integrators\n"
+		"  -j N         number of threads (default: number of CPUs)\n"
+		"  -C           only check that a unity gain system measures 0 dB (within\n"
+		"               %g dB), for each sample rate, instead of writing a file\n",
+		argv0, argv0, UNITY_TOLERANCE_DB);
+}
+
+int main(int argc, char **argv) {
+	options o;
+	o.sample_rates[0] = 48e3f;
+	o.n_sample_rates = 1;
+	o.cutoff_first = 0;
+	o.cutoff_step = 1;
+	o.cutoff_last = 2047;
+	o.resonance_first = 0;
+	o.resonance_step = 15;
+	o.resonance_last = 15;
+	o.f_start = 20.0;
+	o.f_end = 20e3;
+	o.length = 2.0;
+	o.silence = 0.5;
+	o.ir_length = 0.1;
+	o.ir_pre = 32;
+	o.n_harmonics = 5;
+	o.window = 2048;
+	o.amplitude = 1.f;
+	o.mode = 2;
+	o.quality = 0;
+	o.nonlinear = 0;
+	o.n_threads = 0;
+	char check = 0;
+
+	int i;
+	for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+		const char opt = argv[i][1];
+		if (opt == 'R' && argv[i][2] == '\0') {
+			o.quality = 1;
+			continue;
+		}
+		if (opt == 'N' && argv[i][2] == '\0') {
+			o.nonlinear = 1;
+			continue;
+		}
+		if (opt == 'C' && argv[i][2] == '\0') {
+			check = 1;
+			continue;
+		}
+		if (argv[i][2] != '\0' || i + 1 == argc) {
+			usage(argv[0]);
+			return 1;
+		}
+		const char *v = argv[++i];
+		int err = 0;
+		switch (opt) {
+		case 'r':
+			err = parse_rates(v, &o);
+			break;
+		case 'c':
+			err = parse_range(v, &o.cutoff_first, &o.cutoff_step, &o.cutoff_last, 2047);
+			break;
+		case 'q':
+			err = parse_range(v, &o.resonance_first, &o.resonance_step, &o.resonance_last, 15);
+			break;
+		case 'm':
+			o.mode = parse_mode(v);
+			err = o.mode < 0;
+			break;
+		case 'a':
+			o.amplitude = strtof(v, NULL);
+			err = !(o.amplitude > 0.f);
+			break;
+		case 'T':
+			o.length = strtod(v, NULL);
+			err = !(o.length > 0.0);
+			break;
+		case 's':
+			o.silence = strtod(v, NULL);
+			err = !(o.silence >= 0.0);
+			break;
+		case 'f':
+			err = sscanf(v, "%lf:%lf", &o.f_start, &o.f_end) != 2 || !(o.f_start > 0.0) || !(o.f_end > o.f_start);
+			break;
+		case 'l':
+			o.ir_length = strtod(v, NULL);
+			err = !(o.ir_length > 0.0);
+			break;
+		case 'p':
+			o.ir_pre = atoi(v);
+			err = o.ir_pre < 0;
+			break;
+		case 'k':
+			o.n_harmonics = atoi(v);
+			err = o.n_harmonics < 1;
+			break;
+		case 'w':
+			o.window = atoi(v);
+			err = o.window < 4 || (o.window & (o.window - 1));
+			break;
+		case 'j':
+			o.n_threads = atoi(v);
+			err = o.n_threads < 0;
+			break;
+		default:
+			err = 1;
+		}
+		if (err) {
+			fprintf(stderr, "Invalid value for -%c: %s\n", opt, v);
+			return 1;
+		}
+	}
+	if (i + (check ? 0 : 1) != argc) {
+		usage(argv[0]);
+		return 1;
+	}
+	const char *path = argv[i];
+
+	for (int r = 0; r < o.n_sample_rates; r++)
+		if (!(o.f_end < 0.5 * o.sample_rates[r])) {
+			fprintf(stderr, "Sweep end frequency must be below Nyquist (%g Hz)\n", 0.5 * o.sample_rates[r]);
+			return 1;
+		}
+
+	o.n_cutoffs = (o.cutoff_last - o.cutoff_first) / o.cutoff_step + 1;
+	o.n_resonances = (o.resonance_last - o.resonance_first) / o.resonance_step + 1;
+	o.n_records = o.n_sample_rates * o.n_resonances * o.n_cutoffs;
+
+	if (o.n_threads == 0) {
+		const long n = sysconf(_SC_NPROCESSORS_ONLN);
+		o.n_threads = n > 0 ? n : 1;
+	}
+	if (o.n_threads > MAX_THREADS)
+		o.n_threads = MAX_THREADS;
+	if (o.n_threads > o.n_records)
+		o.n_threads = o.n_records;
+
+	rate_data rates[MAX_SAMPLE_RATES];
+	memset(rates, 0, sizeof(rates));
+	int ret = 1;
+	float **records = (float **)calloc(o.n_records, sizeof(float *));
+	if (records == NULL)
+		goto err_records;
+	for (int r = 0; r < o.n_sample_rates; r++)
+		if (rate_data_init(rates + r, &o, o.sample_rates[r])) {
+			fprintf(stderr, "Could not set up sweep at %g Hz (out of memory or IR/harmonic windows not fitting)\n", o.sample_rates[r]);
+			goto err_rates;
+		}
+	if (check) {
+		ret = check_unity(&o, rates);
+		goto err_rates;
+	}
+	const int per_rate = o.n_cutoffs * o.n_resonances;
+	for (int n = 0; n < o.n_records; n++) {
+		records[n] = (float *)malloc(record_size(&o, rates + n / per_rate) * sizeof(float));
+		if (records[n] == NULL) {
+			fprintf(stderr, "Out of memory\n");
+			goto err_rates;
+		}
+	}
+
+	job j;
+	j.opts = &o;
+	j.rates = rates;
+	j.records = records;
+	j.next = 0;
+	j.done = 0;
+	j.failed = 0;
+	pthread_mutex_init(&j.lock, NULL);
+
+	pthread_t threads[MAX_THREADS];
+	int n_started = 0;
+	for (; n_started < o.n_threads - 1; n_started++)
+		if (pthread_create(threads + n_started, NULL, worker, &j))
+			break;
+	worker(&j);
+	for (int t = 0; t < n_started; t++)
+		pthread_join(threads[t], NULL);
+	pthread_mutex_destroy(&j.lock);
+	fprintf(stderr, "\n");
+
+	if (j.failed) {
+		fprintf(stderr, "Out of memory\n");
+		goto err_rates;
+	}
+	if (write_output(path, &o, rates, records)) {
+		fprintf(stderr, "Could not write %s: %s\n", path, strerror(errno));
+		goto err_rates;
+	}
+	ret = 0;
+
+err_rates:
+	for (int r = 0; r < o.n_sample_rates; r++)
+		rate_data_free(rates + r);
+	for (int n = 0; n < o.n_records; n++)
+		free(records[n]);
+	free(records);
+err_records:
+	return ret;
+}
@@ -0,0 +1,15 @@
+#!/bin/bash
+
+# Builds build/guibench, the editor on the offscreen GUI backend
+
+mkdir -p build
+
+g++ \
+	tests/guibench.c \
+	src/asid_gui.c \
+	src/gui-offscreen.c \
+	\
+	-Isrc \
+	-o build/guibench \
+	-O3 \
+	-ffast-math
@@ -38,7 +38,12 @@ g++ \
 	$VST_SDK_DIR/vst3sdk/public.sdk/source/vst/vstparameters.cpp \
 	\
 	../src/asid.c \
+	../src/mos_filter.c \
 	../src/mos_8580_filter.c \
+	../src/mos_6581_filter.c \
+	../src/mos_output_buffer.c \
+	../src/halfband.c \
+	../src/mos_calibration.c \
 	src/asid_gui.c \
 	src/gui-x.c \
 	\
@@ -47,7 +52,7 @@ g++ \
 	-Isrc \
 	-I$VST_SDK_DIR/vst3sdk/ \
 	-fPIC -shared \
-	-lxcb \
+	-lxcb -lxcb-shm \
 	-o build/asid.vst3/Contents/x86_64-linux/asid.so \
 	-O3 \
 	-ffast-math
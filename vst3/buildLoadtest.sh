@@ -0,0 +1,20 @@
+#!/bin/bash
+
+# Builds build/loadtest, run ./buildLinux.sh first to get something to load
+
+VST_SDK_DIR=../../VST_SDK
+
+mkdir -p build
+
+g++ \
+	tests/loadtest.cpp \
+	$VST_SDK_DIR/vst3sdk/pluginterfaces/base/coreiids.cpp \
+	$VST_SDK_DIR/vst3sdk/pluginterfaces/base/funknown.cpp \
+	$VST_SDK_DIR/vst3sdk/public.sdk/source/vst/vstinitiids.cpp \
+	\
+	-I../src \
+	-Isrc \
+	-I$VST_SDK_DIR/vst3sdk/ \
+	-ldl \
+	-o build/loadtest \
+	-O2
@@ -39,7 +39,12 @@ SOURCES="
 	$VST_SDK_DIR/vst3sdk/base/source/fbuffer.cpp \
 	$VST_SDK_DIR/vst3sdk/public.sdk/source/main/macmain.cpp \
 	../src/asid.c \
+	../src/mos_filter.c \
 	../src/mos_8580_filter.c \
+	../src/mos_6581_filter.c \
+	../src/mos_output_buffer.c \
+	../src/halfband.c \
+	../src/mos_calibration.c \
 	src/asid_gui.c \
 	src/gui-cocoa.mm \
 "
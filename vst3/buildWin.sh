@@ -41,7 +41,12 @@ g++ \
 	$VST_SDK_DIR/vst3sdk/base/source/fbuffer.cpp \
 	\
 	../src/asid.c \
+	../src/mos_filter.c \
 	../src/mos_8580_filter.c \
+	../src/mos_6581_filter.c \
+	../src/mos_output_buffer.c \
+	../src/halfband.c \
+	../src/mos_calibration.c \
 	src/asid_gui.c \
 	src/gui-win32.c \
 	\
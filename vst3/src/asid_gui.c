@@ -27,6 +27,14 @@
 
 #include <stdio.h>
 
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(GUI_NO_SIMD)
+# include <emmintrin.h>
+# define GUI_SSE2
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(GUI_NO_SIMD)
+# include <arm_neon.h>
+# define GUI_NEON
+#endif
+
 #define BILINEAR_INTERPOLATION
 
 static const uint32_t width_default = 404;
@@ -35,6 +43,9 @@ static const uint32_t height_default = 284;
 static const uint32_t inner_width_default = 320;
 static const uint32_t inner_height_default = 200;
 static const uint32_t inner_size_pixel = inner_width_default * inner_height_default * 4;
+static const uint32_t inner_width_cells = 40;
+
+static const uint32_t refine_ticks = 5;	// timeouts with the same size before refine()
 
 static const float imgrate = 1.422535211267606f;
 static const float innerImgrate = 1.6f;
@@ -84,7 +95,48 @@ static uint8_t colors_default[4][3] = {
 
 static uint8_t color_grey[3] = {51, 51, 51};
 
-static const uint8_t* screen_map_defaults[] = {screen1_map_default, screen2_map_default, screen3_map_default, screen4_map_default};
+// Screens are stored as on the C64: one shared hi-res bitmap (8x8 pixel cells,
+// a byte per cell row, leftmost pixel in the MSB) and a colormap per screen
+// (a byte per cell, set bits get the color in the high nibble, clear ones the
+// one in the low nibble). They are composed with the GUI state when drawn.
+
+static const unsigned char* screen_bitmap = bitmap_dat;
+static const unsigned char* screen_colormaps[4] = {colormap1_dat, colormap2_dat, colormap3_dat, colormap4_dat};
+
+// C64 palette, BGR like colors_default
+static const uint8_t palette[16][3] = {
+	{0, 0, 0},
+	{255, 255, 255},
+	{0, 0, 136},
+	{238, 255, 170},
+	{204, 68, 204},
+	{102, 204, 0},
+	{170, 0, 0},
+	{119, 238, 238},
+	{85, 136, 221},
+	{0, 68, 102},
+	{119, 119, 255},
+	{51, 51, 51},
+	{119, 119, 119},
+	{102, 255, 170},
+	{255, 136, 0},
+	{187, 187, 187}
+};
+static const uint8_t color_white = 1;
+
+// Scaling tables, computed once per size: for each destination pixel, the
+// source pixel on the left (above) and the weight of the next one in 1/256,
+// from 0 to 256. The first one is never the last source pixel, so that both
+// can always be read. nearest is set when weights are all 0 or 256, e.g., at
+// integer multiples of the source size, then pixels are just copied.
+typedef struct {
+	uint32_t	*index;
+	uint16_t	*weight;
+	uint32_t	 n;
+	char		 nearest;
+} scale_table;
+
+typedef struct _scaled_screen* scaled_screen;
 
 struct _asid_gui {
 	gui	 	 g;
@@ -93,6 +145,12 @@ struct _asid_gui {
 
 	float (*get_parameter)(asid_gui gui, uint32_t id);
 	void (*set_parameter)(asid_gui gui, uint32_t id, float value);
+
+	// Latest values from asid_gui_on_param_set(), applied to the views once
+	// per frame by the first of them to draw
+	float		 mailbox[4];
+	char		 mailbox_set[4];
+	char		 mailbox_full;	// any of mailbox_set
 };
 
 struct _asid_gui_view {
@@ -100,9 +158,12 @@ struct _asid_gui_view {
 	asid_gui_view	 next;
 	window		 win;
 
-	unsigned char* screen_maps[4];
-
-	unsigned char* resized[4];
+	unsigned char* composed;	// visible screen, inner_width_default x inner_height_default
+	unsigned char* resized;		// and scaled in the window
+	char ready;			// resized and scaling tables are there for the current size
+	scale_table cols;	// content, from inner_width_default to wContent
+	scale_table rows;	// and from inner_height_default to hContent
+	scaled_screen art;	// visible screen, from the cache
 
 	float scaleFactor;
 	float scaleFactorInv;
@@ -161,6 +222,12 @@ struct _asid_gui_view {
 	char paramToRedraw[3];
 	char modCutoffToRedraw;
 	char toResize;
+	uint32_t refine;	// ticks left before refine(), 0 if none
+
+	uint32_t damage_x;
+	uint32_t damage_y;
+	uint32_t damage_w;	// 0 if nothing to present
+	uint32_t damage_h;
 };
 
 static uint32_t floorI(float x) {
@@ -172,11 +239,6 @@ static uint32_t ceilI(float x) {
 	return f + (x - (float) f <= 0.000001f ? 0 : 1);
 }
 
-static void floorceilI(float x, uint32_t* floor, uint32_t* ceil) {
-	*floor = (uint32_t) x;
-	*ceil  = *floor + (x - (float) *floor <= 0.000001f ? 0 : 1);
-}
-
 static uint32_t minI(uint32_t x1, uint32_t x2) {
 	return x1 <= x2 ? x1 : x2;
 }
@@ -193,311 +255,520 @@ static float clipF(float x, float min, float max) {
 	return minF(max, maxF(min, x));
 }
 
-static void interpolate (
-	unsigned char *src, unsigned char *dest, 
-	uint32_t src_w, uint32_t src_h,
-	uint32_t src_target_x, uint32_t src_target_y, uint32_t src_target_w, uint32_t src_target_h,
-	uint32_t dest_w, uint32_t dest_h,
-	uint32_t dest_target_x, uint32_t dest_target_y, uint32_t dest_target_w, uint32_t dest_target_h)
-{
-#ifdef BILINEAR_INTERPOLATION
-	const float w_scale_factor = (float) src_target_w / (float) dest_target_w;
-	const float h_scale_factor = (float) src_target_h / (float) dest_target_h;
-
-	const uint32_t wOffset = (dest_w - dest_target_w) << 2;
-	uint32_t newIndex = (dest_target_y * dest_w + dest_target_x) << 2;
-
-	for (uint32_t ri = 0; ri < dest_target_h; ri++) {
-		const float y = (float) ri * h_scale_factor + src_target_y;
-		uint32_t y_floor, y_ceil;
-		floorceilI(y, &y_floor, &y_ceil);
-		y_ceil = minI(src_h - 1, y_ceil);
-		const int B = (int) ((y - (float) y_floor) * 255.f);
-
-		for (uint32_t ci = 0; ci < dest_target_w; ci++) {
-
-			const float x = (float) ci * w_scale_factor + src_target_x;
-			uint32_t x_floor, x_ceil;
-			floorceilI(x, &x_floor, &x_ceil);
-			x_ceil = minI(src_w - 1, x_ceil);
-			
-			unsigned char a, b, c;
-
-			if (x_ceil == x_floor && y_ceil == y_floor) {
-				const uint32_t pixelIndex = (y_floor * src_w + x_floor) << 2;
-				a = src[pixelIndex + 0];
-				b = src[pixelIndex + 1];
-				c = src[pixelIndex + 2];
-			}
-
-			else if (x_ceil == x_floor) {
-				const uint32_t pixelIndex1 = (y_floor * src_w + x_floor) << 2;
-				const uint32_t pixelIndex2 = pixelIndex1 + (src_w << 2);
-
-				a = (unsigned char) ((int) src[pixelIndex1 + 0] + ((B * ((int) src[pixelIndex2 + 0] - (int) src[pixelIndex1 + 0])) >> 8));
-				b = (unsigned char) ((int) src[pixelIndex1 + 1] + ((B * ((int) src[pixelIndex2 + 1] - (int) src[pixelIndex1 + 1])) >> 8));
-				c = (unsigned char) ((int) src[pixelIndex1 + 2] + ((B * ((int) src[pixelIndex2 + 2] - (int) src[pixelIndex1 + 2])) >> 8));
-			}
+static void scale_table_init(scale_table *t) {
+	t->index = NULL;
+	t->weight = NULL;
+	t->n = 0;
+	t->nearest = 0;
+}
 
-			else if (y_ceil == y_floor) {
-				const uint32_t pixelIndex1 = (y_floor * src_w + x_floor) << 2;
-				const uint32_t pixelIndex2 = pixelIndex1 + 4;
+static void scale_table_free(scale_table *t) {
+	free(t->index);
+	free(t->weight);
+}
 
-				const int A = (int) ((x - (float) x_floor) * 255.f);
+// src_n >= 2, fast forces nearest neighbor
+static char scale_table_set(scale_table *t, uint32_t src_n, uint32_t dest_n, char fast) {
+	if (t->n != dest_n) {
+		t->n = 0;
+		uint32_t *index = (uint32_t *)realloc(t->index, dest_n * sizeof(uint32_t));
+		if (index == NULL)
+			return 0;
+		t->index = index;
+		uint16_t *weight = (uint16_t *)realloc(t->weight, dest_n * sizeof(uint16_t));
+		if (weight == NULL)
+			return 0;
+		t->weight = weight;
+		t->n = dest_n;
+	}
 
-				a = (unsigned char) ((int) src[pixelIndex1 + 0] + ((A * ((int) src[pixelIndex2 + 0] - (int) src[pixelIndex1 + 0])) >> 8));
-				b = (unsigned char) ((int) src[pixelIndex1 + 1] + ((A * ((int) src[pixelIndex2 + 1] - (int) src[pixelIndex1 + 1])) >> 8));
-				c = (unsigned char) ((int) src[pixelIndex1 + 2] + ((A * ((int) src[pixelIndex2 + 2] - (int) src[pixelIndex1 + 2])) >> 8));
+#ifdef BILINEAR_INTERPOLATION
+	const uint32_t factor = dest_n % src_n == 0 ? dest_n / src_n : 0;
+	t->nearest = factor != 0 || fast;
+#else
+	const uint32_t factor = 0;
+	t->nearest = 1;
+#endif
+	for (uint32_t i = 0; i < dest_n; i++) {
+		uint32_t index, weight;
+		if (factor != 0) {
+			index = i / factor;
+			weight = 0;
+		} else {
+			const uint32_t x = (uint32_t)(((uint64_t)i * src_n << 8) / dest_n);	// 24.8 fixed point
+			index = x >> 8;
+			weight = x & 0xff;
+			if (t->nearest) {
+				index += weight >> 7;
+				weight = 0;
 			}
+		}
+		if (index >= src_n - 1) {
+			index = src_n - 2;
+			weight = 256;
+		}
+		t->index[i] = index;
+		t->weight[i] = (uint16_t)weight;
+	}
+	return 1;
+}
 
-			else {
-				const uint32_t pixelIndex1 = (y_floor * src_w + x_floor) << 2;
-				const uint32_t pixelIndex2 = pixelIndex1 + 4;
-				const uint32_t pixelIndex3 = pixelIndex1 + (src_w << 2);
-				const uint32_t pixelIndex4 = pixelIndex3 + 4;
-
-				const int A = (int) ((x - (float) x_floor) * 255.f);
-				
-				const int a1 = (int) src[pixelIndex1 + 0] + ((A * ((int) src[pixelIndex2 + 0] - (int) src[pixelIndex1 + 0])) >> 8);
-				const int b1 = (int) src[pixelIndex1 + 1] + ((A * ((int) src[pixelIndex2 + 1] - (int) src[pixelIndex1 + 1])) >> 8);
-				const int c1 = (int) src[pixelIndex1 + 2] + ((A * ((int) src[pixelIndex2 + 2] - (int) src[pixelIndex1 + 2])) >> 8);
-
-				const int a2 = (int) src[pixelIndex3 + 0] + ((A * ((int) src[pixelIndex4 + 0] - (int) src[pixelIndex3 + 0])) >> 8);
-				const int b2 = (int) src[pixelIndex3 + 1] + ((A * ((int) src[pixelIndex4 + 1] - (int) src[pixelIndex3 + 1])) >> 8);
-				const int c2 = (int) src[pixelIndex3 + 2] + ((A * ((int) src[pixelIndex4 + 2] - (int) src[pixelIndex3 + 2])) >> 8);
-
-				a = (unsigned char) (a1 + ((B * (a2 - a1)) >> 8));
-				b = (unsigned char) (b1 + ((B * (b2 - b1)) >> 8));
-				c = (unsigned char) (c1 + ((B * (c2 - c1)) >> 8));
-			}
+#define SCALE_SRC_W_MAX	320
+
+// out = (a * (256 - w) + b * w) >> 8 on n bytes, 0 < w < 256
+static void blend_rows(unsigned char *out, const unsigned char *a, const unsigned char *b, uint32_t w, uint32_t n) {
+	uint32_t i = 0;
+#if defined(GUI_SSE2)
+	const __m128i z = _mm_setzero_si128();
+	const __m128i wa = _mm_set1_epi16((short)(256 - w));
+	const __m128i wb = _mm_set1_epi16((short)w);
+	for (; i + 16 <= n; i += 16) {
+		const __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+		const __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+		const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(va, z), wa), _mm_mullo_epi16(_mm_unpacklo_epi8(vb, z), wb)), 8);
+		const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(va, z), wa), _mm_mullo_epi16(_mm_unpackhi_epi8(vb, z), wb)), 8);
+		_mm_storeu_si128((__m128i *)(out + i), _mm_packus_epi16(lo, hi));
+	}
+#elif defined(GUI_NEON)
+	const uint8x8_t wa = vdup_n_u8((uint8_t)(256 - w));
+	const uint8x8_t wb = vdup_n_u8((uint8_t)w);
+	for (; i + 16 <= n; i += 16) {
+		const uint8x16_t va = vld1q_u8(a + i);
+		const uint8x16_t vb = vld1q_u8(b + i);
+		const uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(va), wa), vget_low_u8(vb), wb);
+		const uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(va), wa), vget_high_u8(vb), wb);
+		vst1q_u8(out + i, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+	}
+#endif
+	for (; i < n; i++)
+		out[i] = (unsigned char)((a[i] * (256 - w) + b[i] * w) >> 8);
+}
 
-			dest[newIndex++] = a;
-			dest[newIndex++] = b;
-			dest[newIndex++] = c;
-			dest[newIndex++] = 0;
+// n destination pixels from a source row, 4th byte set to 0
+static void blend_cols(unsigned char *out, const unsigned char *row, const uint32_t *index, const uint16_t *weight, uint32_t n) {
+	uint32_t i = 0;
+#if defined(GUI_SSE2)
+	const __m128i z = _mm_setzero_si128();
+	const __m128i w256 = _mm_set1_epi16(256);
+	const __m128i mask = _mm_set1_epi32(0x00ffffff);
+	for (; i + 4 <= n; i += 4) {
+		__m128i v[2];
+		for (int j = 0; j < 2; j++) {
+			const uint32_t k = i + (j << 1);
+			// left and right source pixels of two destination pixels
+			const __m128i p = _mm_unpacklo_epi64(
+				_mm_loadl_epi64((const __m128i *)(row + (index[k] << 2))),
+				_mm_loadl_epi64((const __m128i *)(row + (index[k + 1] << 2))));
+			const __m128i lo = _mm_unpacklo_epi8(p, z);
+			const __m128i hi = _mm_unpackhi_epi8(p, z);
+			const __m128i wr = _mm_set_epi16(weight[k + 1], weight[k + 1], weight[k + 1], weight[k + 1], weight[k], weight[k], weight[k], weight[k]);
+			const __m128i wl = _mm_sub_epi16(w256, wr);
+			v[j] = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi64(lo, hi), wl), _mm_mullo_epi16(_mm_unpackhi_epi64(lo, hi), wr)), 8);
 		}
-		newIndex += wOffset;
+		_mm_storeu_si128((__m128i *)(out + (i << 2)), _mm_and_si128(_mm_packus_epi16(v[0], v[1]), mask));
 	}
-#else
-	const float w_scale_factor = (float) src_target_w / (float) dest_target_w;
-	const float h_scale_factor = (float) src_target_h / (float) dest_target_h;
-
-	const uint32_t wOffset = (dest_w - dest_target_w) << 2;
-	uint32_t newIndex = (dest_target_y * dest_w + dest_target_x) << 2;
-
-	for (uint32_t ri = 0; ri < dest_target_h; ri++) {
-		const float y = (float) ri * h_scale_factor + src_target_y;
-		uint32_t y_floor, y_ceil;
-		floorceilI(y, &y_floor, &y_ceil);
-		y_ceil = minI(src_h - 1, y_ceil);
-
-		const uint32_t yFall = y - y_floor < 0.5f ? y_floor : y_ceil;
-		
-		for (uint32_t ci = 0; ci < dest_target_w; ci++) {
-
-			const float x = (float) ci * w_scale_factor + src_target_x;
-			uint32_t x_floor, x_ceil;
-			floorceilI(x, &x_floor, &x_ceil);
-			x_ceil = minI(src_w - 1, x_ceil);
-			
-			const uint32_t xFall = x - x_floor < 0.5f ? x_floor : x_ceil;
-
-			const uint32_t pixelIndex = (yFall * src_w + xFall) << 2;
-
-			dest[newIndex++] = src[pixelIndex + 0];;
-			dest[newIndex++] = src[pixelIndex + 1];;
-			dest[newIndex++] = src[pixelIndex + 2];;
-			dest[newIndex++] = 0;
-		}
-		newIndex += wOffset;
+#elif defined(GUI_NEON)
+	const uint16x8_t w256 = vdupq_n_u16(256);
+	const uint8x8_t mask = vreinterpret_u8_u32(vdup_n_u32(0x00ffffff));
+	for (; i + 2 <= n; i += 2) {
+		const uint16x8_t p0 = vmovl_u8(vld1_u8(row + (index[i] << 2)));
+		const uint16x8_t p1 = vmovl_u8(vld1_u8(row + (index[i + 1] << 2)));
+		const uint16x8_t wr = vcombine_u16(vdup_n_u16(weight[i]), vdup_n_u16(weight[i + 1]));
+		const uint16x8_t v = vmlaq_u16(
+			vmulq_u16(vcombine_u16(vget_low_u16(p0), vget_low_u16(p1)), vsubq_u16(w256, wr)),
+			vcombine_u16(vget_high_u16(p0), vget_high_u16(p1)), wr);
+		vst1_u8(out + (i << 2), vand_u8(vshrn_n_u16(v, 8), mask));
 	}
 #endif
+	for (; i < n; i++) {
+		const unsigned char *l = row + (index[i] << 2);
+		const uint32_t w = weight[i];
+		out[(i << 2) + 0] = (unsigned char)((l[0] * (256 - w) + l[4] * w) >> 8);
+		out[(i << 2) + 1] = (unsigned char)((l[1] * (256 - w) + l[5] * w) >> 8);
+		out[(i << 2) + 2] = (unsigned char)((l[2] * (256 - w) + l[6] * w) >> 8);
+		out[(i << 2) + 3] = 0;
+	}
 }
 
-static void draw_parameter_fixed(asid_gui_view view, char p) {
-	uint32_t pb_x1, pb_x2, yValue;
-	uint32_t p_x1, p_x2;
-
-	if (p == 0) {
-		pb_x1 = parambox_cutoff_x1;
-		pb_x2 = parambox_cutoff_x2;
-		p_x1 = param_cutoff_x1;
-		p_x2 = param_cutoff_x2;
-		yValue = (uint32_t) ((1.f - view->paramMappedValues[p]) * (float) params_inner_h) + params_inner_y;
-	}
-	else if (p == 1) {
-		pb_x1 = parambox_lfoamt_x1;
-		pb_x2 = parambox_lfoamt_x2;
-		p_x1 = param_lfoamt_x1;
-		p_x2 = param_lfoamt_x2;
-		yValue = (uint32_t) ((1.f - view->paramMappedValues[p]) * (float) params_inner_h) + params_inner_y;
-	}
-	else if (p == 2) {
-		pb_x1 = parambox_lfospd_x1;
-		pb_x2 = parambox_lfospd_x2;
-		p_x1 = param_lfospd_x1;
-		p_x2 = param_lfospd_x2;
-		yValue = (uint32_t) ((1.f - view->paramMappedValues[p]) * (float) params_inner_h) + params_inner_y;
+static void copy_cols(unsigned char *out, const unsigned char *row, const uint32_t *index, const uint16_t *weight, uint32_t n) {
+	for (uint32_t i = 0; i < n; i++) {
+		const unsigned char *s = row + ((index[i] + (weight[i] >> 8)) << 2);
+		out[(i << 2) + 0] = s[0];
+		out[(i << 2) + 1] = s[1];
+		out[(i << 2) + 2] = s[2];
+		out[(i << 2) + 3] = 0;
 	}
-	else
+}
+
+// Scales the [x1, x2) x [y1, y2) part of the destination space of cols and
+// rows, writing it at (dest_x + x, dest_y + y) of dest
+static void scale(
+	const unsigned char *src, uint32_t src_w,
+	const scale_table *cols, const scale_table *rows,
+	unsigned char *dest, uint32_t dest_w, uint32_t dest_x, uint32_t dest_y,
+	uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2)
+{
+	if (x1 >= x2 || y1 >= y2)
 		return;
 
-	uint32_t index = ((paramboxs_y1) * inner_width_default + pb_x1) << 2;
-	uint32_t wOffset = (inner_width_default - paramboxs_w) << 2;
-
-	if (view->param_hover == p) { // isHover
-		for (uint32_t c = paramboxs_y1; c <= paramboxs_y2; c++) {
-			for (int r = pb_x1; r <= pb_x2; r++) {
-				if (screen_map_defaults[0][index] != 255) {
-					for (char i = 0; i < 4; i++) {
-						view->screen_maps[i][index + 0] = colors_default[i][0];
-						view->screen_maps[i][index + 1] = colors_default[i][1];
-						view->screen_maps[i][index + 2] = colors_default[i][2];
-					}
-				}
-				index += 4;
-			}
-			index += wOffset;
-		}
-	}
-	else {
-		for (uint32_t c = paramboxs_y1; c <= paramboxs_y2; c++) {
-			for (int r = pb_x1; r <= pb_x2; r++) {
-				if (screen_map_defaults[0][index] != 255) {
-					for (char i = 0; i < 4; i++) {
-						view->screen_maps[i][index + 0] = screen_map_defaults[0][index + 0];
-						view->screen_maps[i][index + 1] = screen_map_defaults[0][index + 1];
-						view->screen_maps[i][index + 2] = screen_map_defaults[0][index + 2];
-					}
-				}
-				index += 4;
-			}
-			index += wOffset;
+	unsigned char tmp[(SCALE_SRC_W_MAX + 1) << 2];
+	const uint32_t src_stride = src_w << 2;
+	const uint32_t dest_stride = dest_w << 2;
+	const uint32_t n = x2 - x1;
+	// only the source bytes that are actually read
+	const uint32_t b1 = cols->index[x1] << 2;
+	const uint32_t b2 = (cols->index[x2 - 1] + 2) << 2;
+
+	unsigned char *d = dest + (((dest_y + y1) * dest_w + dest_x + x1) << 2);
+	for (uint32_t y = y1; y < y2; y++, d += dest_stride) {
+		if (y > y1 && rows->index[y] == rows->index[y - 1] && rows->weight[y] == rows->weight[y - 1]) {
+			memcpy(d, d - dest_stride, n << 2);
+			continue;
 		}
-	}
-	index = (params_inner_y * inner_width_default + p_x1 + 1) << 2;
-	wOffset = (inner_width_default - params_w) << 2;
-	for (uint32_t c = params_inner_y; c < yValue; c++) {
-		for (int r = p_x1 + 1; r < p_x2; r++) {
-			for (char i = 0; i < 4; i++) {
-				view->screen_maps[i][index + 0] = 255;
-				view->screen_maps[i][index + 1] = 255;
-				view->screen_maps[i][index + 2] = 255;
-			}
-			index += 4;
+
+		const unsigned char *row = src + rows->index[y] * src_stride;
+		const uint32_t w = rows->weight[y];
+		if (w == 256)
+			row += src_stride;
+		else if (w != 0) {
+			blend_rows(tmp + b1, row + b1, row + src_stride + b1, w, b2 - b1);
+			row = tmp;
 		}
-		index += wOffset;
+
+		if (cols->nearest)
+			copy_cols(d, row, cols->index + x1, cols->weight + x1, n);
+		else
+			blend_cols(d, row, cols->index + x1, cols->weight + x1, n);
 	}
 }
 
-static void draw_parameter_resized(asid_gui_view view, char p) {
-	uint32_t pb_x1, resized_x1;
+static void param_geometry(char p, uint32_t *pb_x1, uint32_t *pb_x2, uint32_t *p_x1, uint32_t *p_x2) {
 	if (p == 0) {
-		pb_x1 = parambox_cutoff_x1;
-		resized_x1 = view->xBoxCutoff;
+		*pb_x1 = parambox_cutoff_x1;
+		*pb_x2 = parambox_cutoff_x2;
+		*p_x1 = param_cutoff_x1;
+		*p_x2 = param_cutoff_x2;
 	}
 	else if (p == 1) {
-		pb_x1 = parambox_lfoamt_x1;
-		resized_x1 = view->xBoxAmount;
+		*pb_x1 = parambox_lfoamt_x1;
+		*pb_x2 = parambox_lfoamt_x2;
+		*p_x1 = param_lfoamt_x1;
+		*p_x2 = param_lfoamt_x2;
 	}
-	else if (p == 2) {
-		pb_x1 = parambox_lfospd_x1;
-		resized_x1 = view->xBoxSpeed;
+	else {
+		*pb_x1 = parambox_lfospd_x1;
+		*pb_x2 = parambox_lfospd_x2;
+		*p_x1 = param_lfospd_x1;
+		*p_x2 = param_lfospd_x2;
 	}
-	else
-		return;
+}
 
-	for (int ri = 0; ri < 4; ri++) {
-		interpolate(
-			view->screen_maps[ri], view->resized[ri], 
-			inner_width_default, inner_height_default,  
-			pb_x1, paramboxs_y1, paramboxs_w, paramboxs_h,
-			view->w, view->h,
-			resized_x1, view->yBoxParams, view->wBoxParams, view->hBoxParams);
-	}
+// Palette index
+static uint8_t screen_color(int s, uint32_t x, uint32_t y) {
+	const uint32_t cell = (y >> 3) * inner_width_cells + (x >> 3);
+	const uint8_t cm = screen_colormaps[s][cell];
+	return (screen_bitmap[(cell << 3) + (y & 7)] >> (7 - (x & 7))) & 1 ? cm >> 4 : cm & 0xf;
 }
 
-static void update_view_parameter(asid_gui_view view, char p) {
-	uint32_t resized_x1;
-	if (p == 0) {
-		resized_x1 = view->xBoxCutoff;
+// Just the art, inner_width_default x inner_height_default
+static void compose_screen(unsigned char *dest, int s) {
+	for (uint32_t y = 0; y < inner_height_default; y++)
+		for (uint32_t x = 0; x < inner_width_default; x++, dest += 4) {
+			const uint8_t *color = palette[screen_color(s, x, y)];
+			dest[0] = color[0];
+			dest[1] = color[1];
+			dest[2] = color[2];
+			dest[3] = 0;
+		}
+}
+
+// Visible screen with sliders, hover and modulated cutoff on top, in the
+// [x1, x2) x [y1, y2) rectangle of view->composed
+static void compose(asid_gui_view view, uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2) {
+	const int s = view->screen_map_selected;
+
+	uint32_t pb_x1[3], pb_x2[3], p_x1[3], p_x2[3], yValue[3];
+	for (int p = 0; p < 3; p++) {
+		param_geometry(p, pb_x1 + p, pb_x2 + p, p_x1 + p, p_x2 + p);
+		yValue[p] = (uint32_t) ((1.f - view->paramMappedValues[p]) * (float) params_inner_h) + params_inner_y;
 	}
-	else if (p == 1) {
-		resized_x1 = view->xBoxAmount;
+	const uint32_t yMid = modCutoff_y1 + (uint32_t) ((1.f - view->modCutoffValue) * modCutoff_h);
+	const uint8_t *modCutoffColor = view->param_selected == 0 || view->param_hover == 0 ? colors_default[s] : color_grey;
+
+	for (uint32_t y = y1; y < y2; y++) {
+		unsigned char *d = view->composed + ((y * inner_width_default + x1) << 2);
+		for (uint32_t x = x1; x < x2; x++, d += 4) {
+			const uint8_t c = screen_color(s, x, y);
+			const uint8_t *color = palette[c];
+
+			if (x >= modCutoff_x1 && x <= modCutoff_x2 && y >= modCutoff_y1 && y <= modCutoff_y2)
+				color = y < yMid ? palette[color_white] : modCutoffColor;
+			else if (y >= paramboxs_y1 && y <= paramboxs_y2) {
+				for (int p = 0; p < 3; p++) {
+					if (x < pb_x1[p] || x > pb_x2[p])
+						continue;
+					if (x > p_x1[p] && x < p_x2[p] && y >= params_inner_y && y < yValue[p])
+						color = palette[color_white]; // slider, above value
+					else if (view->param_hover == p && c != color_white)
+						color = colors_default[s];
+					break;
+				}
+			}
+
+			d[0] = color[0];
+			d[1] = color[1];
+			d[2] = color[2];
+			d[3] = 0;
+		}
 	}
-	else if (p == 2) {
-		resized_x1 = view->xBoxSpeed;
+}
+
+static void draw_parameter_fixed(asid_gui_view view, char p) {
+	uint32_t pb_x1, pb_x2, p_x1, p_x2;
+	param_geometry(p, &pb_x1, &pb_x2, &p_x1, &p_x2);
+	compose(view, pb_x1, paramboxs_y1, pb_x2 + 1, paramboxs_y2 + 1);
+}
+
+// [d1, d2) destination pixels that read any of the [s1, s2] source pixels
+static void scale_table_range(const scale_table *t, uint32_t s1, uint32_t s2, uint32_t *d1, uint32_t *d2) {
+	uint32_t i = 0;
+	for (; i < t->n; i++)
+		if (t->index[i] + (t->weight[i] != 0) >= s1)
+			break;
+	*d1 = i;
+	for (; i < t->n; i++)
+		if (t->index[i] + (t->weight[i] == 256) > s2)
+			break;
+	*d2 = i;
+}
+
+// Content area that depends on parameter box p
+static void param_box_resized(asid_gui_view view, char p, uint32_t *x1, uint32_t *y1, uint32_t *x2, uint32_t *y2) {
+	uint32_t pb_x1, pb_x2, p_x1, p_x2;
+	param_geometry(p, &pb_x1, &pb_x2, &p_x1, &p_x2);
+	scale_table_range(&view->cols, pb_x1, pb_x2, x1, x2);
+	scale_table_range(&view->rows, paramboxs_y1, paramboxs_y2, y1, y2);
+}
+
+static void draw_parameter_resized(asid_gui_view view, char p) {
+	// With the content tables, so that it matches the whole redraw exactly
+	uint32_t x1, y1, x2, y2;
+	param_box_resized(view, p, &x1, &y1, &x2, &y2);
+	scale(view->composed, inner_width_default, &view->cols, &view->rows,
+		view->resized, view->w, view->xContent, view->yContent, x1, y1, x2, y2);
+}
+
+// Window area changed since the last present() as one rectangle: all that
+// changes in a tick is either the whole content or boxes in the same row, so
+// the bounding box costs little more than the boxes and takes a single upload
+static void damage(asid_gui_view view, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	if (width == 0 || height == 0)
+		return;
+	if (view->damage_w == 0) {
+		view->damage_x = x;
+		view->damage_y = y;
+		view->damage_w = width;
+		view->damage_h = height;
+		return;
 	}
-	else
+	const uint32_t x2 = x + width > view->damage_x + view->damage_w ? x + width : view->damage_x + view->damage_w;
+	const uint32_t y2 = y + height > view->damage_y + view->damage_h ? y + height : view->damage_y + view->damage_h;
+	view->damage_x = minI(x, view->damage_x);
+	view->damage_y = minI(y, view->damage_y);
+	view->damage_w = x2 - view->damage_x;
+	view->damage_h = y2 - view->damage_y;
+}
+
+static void present(asid_gui_view view) {
+	if (view->damage_w == 0)
 		return;
+	gui_window_draw (view->win, view->resized, 
+		view->damage_x, view->damage_y, view->w, view->h, 
+		view->damage_x, view->damage_y, view->damage_w, view->damage_h);
+	view->damage_w = 0;
+}
 
-	gui_window_draw (view->win, view->resized[view->screen_map_selected], 
-		resized_x1, view->yBoxParams, view->w, view->h, 
-		resized_x1, view->yBoxParams, view->wBoxParams, view->hBoxParams);
+static void update_view_parameter(asid_gui_view view, char p) {
+	uint32_t x1, y1, x2, y2;
+	param_box_resized(view, p, &x1, &y1, &x2, &y2);
+	damage(view, view->xContent + x1, view->yContent + y1, x2 - x1, y2 - y1);
 }
 
 static void draw_modCutoff_slider_fixed (asid_gui_view view) {
-	static const uint32_t indexStart = (modCutoff_y1 * inner_width_default + modCutoff_x1) << 2;
-	static const uint32_t wOffset = (inner_width_default - modCutoff_w) << 2; 
-	const uint32_t yMid = modCutoff_y1 + (uint32_t) ((1.f - view->modCutoffValue) * modCutoff_h);
-	uint8_t* colors = color_grey;
-	for (int ri = 0; ri < 4; ri++) {
-		if (view->param_selected == 0 || view->param_hover == 0)
-			colors = colors_default[ri];
-		uint32_t index = indexStart;
-		uint32_t r = modCutoff_y1;
-		for (; r < yMid; r++) {
-			for (uint32_t c = modCutoff_x1; c <= modCutoff_x2; c++) {
-				view->screen_maps[ri][index + 0] = 255; // Optimize: see array of char as array of int32.
-				view->screen_maps[ri][index + 1] = 255;
-				view->screen_maps[ri][index + 2] = 255;
-				index += 4;
-			}
-			index += wOffset;
-		}
-		for (; r <= modCutoff_y2; r++) {
-			for (uint32_t c = modCutoff_x1; c <= modCutoff_x2; c++) {
-				view->screen_maps[ri][index + 0] = colors[0];
-				view->screen_maps[ri][index + 1] = colors[1];
-				view->screen_maps[ri][index + 2] = colors[2];
-				index += 4;
-			}
-			index += wOffset;
+	compose(view, modCutoff_x1, modCutoff_y1, modCutoff_x2 + 1, modCutoff_y2 + 1);
+}
+
+// Scaled screens without GUI state, shared by all views in the process and
+// kept in most recently used order, so that new views and screen changes
+// don't need scaling. Only settled sizes get in, see refine(), and those not
+// in use are evicted above cache_max_entries, that is, the four screens at
+// one window size. Views are only touched from the UI thread, and so is the
+// cache.
+struct _scaled_screen {
+	scaled_screen	 prev;
+	scaled_screen	 next;
+	uint32_t	 refs;
+	int		 screen;
+	uint32_t	 w;
+	uint32_t	 h;
+	char		 mode;	// nearest flags of the tables
+	unsigned char	*data;	// w x h
+};
+
+static const uint32_t cache_max_entries = 4;
+static scaled_screen cache_head = NULL;
+static uint32_t gui_count = 0;	// cache emptied when 0
+static uint32_t cache_entries = 0;
+
+static void cache_unlink(scaled_screen e) {
+	if (e->prev)
+		e->prev->next = e->next;
+	else
+		cache_head = e->next;
+	if (e->next)
+		e->next->prev = e->prev;
+}
+
+static void cache_push(scaled_screen e) {
+	e->prev = NULL;
+	e->next = cache_head;
+	if (cache_head)
+		cache_head->prev = e;
+	cache_head = e;
+}
+
+static void cache_evict(uint32_t max_entries) {
+	if (cache_head == NULL)
+		return;
+	scaled_screen e = cache_head;
+	while (e->next)
+		e = e->next;
+	while (e && cache_entries > max_entries) {
+		scaled_screen prev = e->prev;
+		if (e->refs == 0) {
+			cache_unlink(e);
+			cache_entries--;
+			free(e->data);
+			free(e);
 		}
+		e = prev;
 	}
 }
 
-static void draw_padding (unsigned char* img, uint32_t xBlack, uint32_t yBlack, uint32_t wBlack, uint32_t hBlack,
-	uint32_t xWhite, uint32_t yWhite, uint32_t wWhite, uint32_t hWhite) {
-	memset(img, 0, (wBlack * hBlack) << 2);
+static scaled_screen cache_get(int screen, const scale_table *cols, const scale_table *rows) {
+	const char mode = cols->nearest | (rows->nearest << 1);
+	scaled_screen e;
+	for (e = cache_head; e; e = e->next)
+		if (e->screen == screen && e->w == cols->n && e->h == rows->n && e->mode == mode) {
+			cache_unlink(e);
+			cache_push(e);
+			e->refs++;
+			return e;
+		}
 
-	uint32_t index = (yWhite * wBlack + xWhite) << 2;
-	for (uint32_t i = 0; i < hWhite; i++) {
-		memset(&(img[index]), 255, wWhite << 2);
-		index += wBlack << 2;
+	e = (scaled_screen) malloc(sizeof(struct _scaled_screen));
+	if (e == NULL)
+		return NULL;
+	const size_t bytes = (size_t)(cols->n * rows->n) << 2;
+	e->data = (unsigned char*) malloc(bytes);
+	unsigned char *art = (unsigned char*) malloc(inner_size_pixel);
+	if (e->data == NULL || art == NULL) {
+		free(art);
+		free(e->data);
+		free(e);
+		return NULL;
 	}
+	compose_screen(art, screen);
+	scale(art, inner_width_default, cols, rows, e->data, cols->n, 0, 0, 0, 0, cols->n, rows->n);
+	free(art);
+
+	e->refs = 1;
+	e->screen = screen;
+	e->w = cols->n;
+	e->h = rows->n;
+	e->mode = mode;
+	cache_push(e);
+	cache_entries++;
+	cache_evict(cache_max_entries);
+	return e;
 }
 
-static void draw_resized (asid_gui_view view) {
-	const uint32_t size = (view->w * view->h) << 2;
-	view->resized[0] = (unsigned char*) realloc(view->resized[0], size);
-	view->resized[1] = (unsigned char*) realloc(view->resized[1], size);
-	view->resized[2] = (unsigned char*) realloc(view->resized[2], size);
-	view->resized[3] = (unsigned char*) realloc(view->resized[3], size);
+static void cache_release(scaled_screen e) {
+	if (e == NULL)
+		return;
+	e->refs--;
+	cache_evict(cache_max_entries);
+}
 
-	if (view->resized[0] == NULL || view->resized[1] == NULL || view->resized[2] == NULL || view->resized[3] == NULL) {
+// Black outside the white rectangle, white around the content, which is left alone
+static void draw_padding (asid_gui_view view) {
+	const uint32_t stride = view->w << 2;
+	unsigned char *row = view->resized;
+	for (uint32_t y = 0; y < view->h; y++, row += stride) {
+		if (y < view->yWhite || y >= view->yWhite + view->hWhite) {
+			memset(row, 0, stride);
+			continue;
+		}
+		memset(row, 0, view->xWhite << 2);
+		memset(row + ((view->xWhite + view->wWhite) << 2), 0, (view->w - view->xWhite - view->wWhite) << 2);
+		if (y < view->yContent || y >= view->yContent + view->hContent)
+			memset(row + (view->xWhite << 2), 255, view->wWhite << 2);
+		else {
+			memset(row + (view->xWhite << 2), 255, (view->xContent - view->xWhite) << 2);
+			memset(row + ((view->xContent + view->wContent) << 2), 255, (view->xWhite + view->wWhite - view->xContent - view->wContent) << 2);
+		}
+	}
+}
+
+// Scaled art from the cache, then the parameter boxes on top, or all scaled
+// in place while the size is still changing (cached = 0)
+static void draw_content(asid_gui_view view, char cached) {
+	scaled_screen art = cached ? cache_get(view->screen_map_selected, &view->cols, &view->rows) : NULL;
+	cache_release(view->art);
+	view->art = art;
+	if (art == NULL) {
+		scale(view->composed, inner_width_default, &view->cols, &view->rows,
+			view->resized, view->w, view->xContent, view->yContent, 0, 0, view->wContent, view->hContent);
 		return;
 	}
 
-	for (int ri = 0; ri < 4; ri++) {
-		draw_padding(view->resized[ri], 0, 0, view->w, view->h, view->xWhite, view->yWhite, view->wWhite, view->hWhite); 
-		interpolate(
-		  	view->screen_maps[ri], view->resized[ri], 
-		  	inner_width_default, inner_height_default,  
-		  	0, 0, inner_width_default, inner_height_default,
-		  	view->w, view->h,
-		  	view->xContent, view->yContent, view->wContent, view->hContent);
+	const uint32_t stride = view->wContent << 2;
+	const unsigned char *s = art->data;
+	unsigned char *d = view->resized + ((view->yContent * view->w + view->xContent) << 2);
+	for (uint32_t y = 0; y < view->hContent; y++, s += stride, d += view->w << 2)
+		memcpy(d, s, stride);
+	for (int p = 0; p < 3; p++)
+		draw_parameter_resized(view, p);
+}
+
+// Nearest neighbor while the size keeps changing, see refine()
+static char draw_resized (asid_gui_view view) {
+	unsigned char *resized = (unsigned char*) realloc(view->resized, (view->w * view->h) << 2);
+	if (resized == NULL)
+		return 0;
+	view->resized = resized;
+
+	if (!scale_table_set(&view->cols, inner_width_default, view->wContent, 1)
+	    || !scale_table_set(&view->rows, inner_height_default, view->hContent, 1))
+		return 0;
+
+	draw_padding(view);
+	draw_content(view, 0);
+	view->refine = refine_ticks;
+	return 1;
+}
+
+// Final quality scaling, through the cache, once the size has settled
+static void refine(asid_gui_view view) {
+	if (!scale_table_set(&view->cols, inner_width_default, view->wContent, 0)
+	    || !scale_table_set(&view->rows, inner_height_default, view->hContent, 0)) {
+		view->ready = 0;
+		return;
 	}
+	draw_content(view, 1);
+	// Same pixels if no interpolation is needed
+	if (!view->cols.nearest || !view->rows.nearest)
+		damage(view, view->xContent, view->yContent, view->wContent, view->hContent);
 }
 
 static void resize(asid_gui_view view, uint32_t width, uint32_t height) {
@@ -551,55 +822,55 @@ static void resize(asid_gui_view view, uint32_t width, uint32_t height) {
 }
 
 static void draw(asid_gui_view view) {
-	for (int i = 0; i < 3; i++) {
-		if (view->paramToRedraw[i])
-			draw_parameter_fixed(view, i);
-	}
-	if (view->modCutoffToRedraw)
-		draw_modCutoff_slider_fixed(view);
-
-	if (view->toResize) {
-		draw_resized(view);
-		gui_window_draw (view->win, view->resized[view->screen_map_selected], 0, 0, view->w, view->h, 0, 0, view->w, view->h);
-		for (int i = 0; i < 3; i++) 
-			view->paramToRedraw[i] = 1;
-		view->modCutoffToRedraw = 0;
+	if (view->toResize || view->screen_map_selected != view->screen_map_selected_old) {
+		// Only the visible screen is composed and scaled
+		compose(view, 0, 0, inner_width_default, inner_height_default);
+		if (view->toResize) {
+			view->ready = draw_resized(view);
+			view->damage_w = 0;
+			if (view->ready)
+				damage(view, 0, 0, view->w, view->h);
+		}
+		else if (view->ready) {
+			draw_content(view, view->refine == 0);
+			damage(view, view->xContent, view->yContent, view->wContent, view->hContent);
+		}
+		view->screen_map_selected_old = view->screen_map_selected;
 		view->toResize = 0;
 	}
 	else {
 		for (int i = 0; i < 3; i++) {
 			if (view->paramToRedraw[i])
-				draw_parameter_resized(view, i);
+				draw_parameter_fixed(view, i);
 		}
-		if (view->paramToRedraw[0] == 0 && view->modCutoffToRedraw)
-			draw_parameter_resized(view, 0);
-
-		if (view->screen_map_selected != view->screen_map_selected_old) {
-			gui_window_draw (view->win, view->resized[view->screen_map_selected], 
-				view->xContent, view->yContent, view->w, view->h, 
-				view->xContent, view->yContent, view->wContent, view->hContent);
-			view->screen_map_selected_old = view->screen_map_selected;
-		}
-		else {
+		if (view->modCutoffToRedraw)
+			draw_modCutoff_slider_fixed(view);
+
+		if (view->ready) {
 			for (int i = 0; i < 3; i++) {
-				if (view->paramToRedraw[i])
+				if (view->paramToRedraw[i]) {
+					draw_parameter_resized(view, i);
 					update_view_parameter(view, i);
+				}
 			}
-			if (view->paramToRedraw[0] == 0 && view->modCutoffToRedraw)
+			if (view->paramToRedraw[0] == 0 && view->modCutoffToRedraw) {
+				draw_parameter_resized(view, 0);
 				update_view_parameter(view, 0);
+			}
 		}
-
-		view->paramToRedraw[0] = 0;
-		view->paramToRedraw[1] = 0;
-		view->paramToRedraw[2] = 0;
-		view->modCutoffToRedraw = 0;
 	}
+
+	present(view);
+
+	view->paramToRedraw[0] = 0;
+	view->paramToRedraw[1] = 0;
+	view->paramToRedraw[2] = 0;
+	view->modCutoffToRedraw = 0;
 }
 
 static void on_resize(window w, uint32_t width, uint32_t height) {
 	asid_gui_view view = (asid_gui_view)gui_window_get_data(w);
 	resize(view, width, height);
-	draw(view);
 }
 
 static void on_mouse_press (window w, int32_t x, int32_t y) {
@@ -701,7 +972,7 @@ static void view_on_param_set(asid_gui_view view, uint32_t id, float value) {
 		view->modCutoffToRedraw = 1;
 	}
 
-	else {
+	else if (id < 3) { // the others have no controls
 		if (view->paramToRedraw[id] == -1) {// Set by the gui
 			view->paramToRedraw[id] = 1;
 			return;
@@ -734,6 +1005,10 @@ asid_gui asid_gui_new(
 	ret->set_parameter = set_parameter;
 	ret->data = data;
 	ret->views = NULL;
+	for (int i = 0; i < 4; i++)
+		ret->mailbox_set[i] = 0;
+	ret->mailbox_full = 0;
+	gui_count++;
 
 	return ret;
 }
@@ -741,10 +1016,16 @@ asid_gui asid_gui_new(
 void asid_gui_free(asid_gui gui) {
 	gui_free(gui->g);
 	free(gui);
+	if (--gui_count == 0)
+		cache_evict(0);
 }
 
 void asid_gui_process_events(asid_gui gui) {
 	gui_run(gui->g, 1);
+	// Only the last of a burst of size changes (e.g., dragging) is drawn
+	for (asid_gui_view view = gui->views; view; view = view->next)
+		if (view->toResize)
+			draw(view);
 }
 
 uint32_t asid_gui_get_default_width(asid_gui gui) {
@@ -759,9 +1040,32 @@ void *asid_gui_get_data(asid_gui gui) {
 	return gui->data;
 }
 
-void asid_gui_on_param_set(asid_gui gui, uint32_t id, float value) {
-	for (asid_gui_view view = gui->views; view; view = view->next)
-		view_on_param_set(view, id, value);
+char asid_gui_on_param_set(asid_gui gui, uint32_t id, float value) {
+	// Closed views read the current values when opened
+	if (gui->views == NULL || id > 3)
+		return 0;
+	gui->mailbox[id] = value;
+	gui->mailbox_set[id] = 1;
+	if (gui->mailbox_full)
+		return 0;
+	gui->mailbox_full = 1;
+	return 1;
+}
+
+static void mailbox_drain(asid_gui gui) {
+	if (!gui->mailbox_full)
+		return;
+	for (int i = 0; i < 4; i++)
+		if (gui->mailbox_set[i]) {
+			for (asid_gui_view view = gui->views; view; view = view->next)
+				view_on_param_set(view, i, gui->mailbox[i]);
+			gui->mailbox_set[i] = 0;
+		}
+	gui->mailbox_full = 0;
+}
+
+int asid_gui_get_fd(asid_gui gui) {
+	return gui_get_fd(gui->g);
 }
 
 asid_gui_view asid_gui_view_new(asid_gui gui, void *parent) {
@@ -771,27 +1075,16 @@ asid_gui_view asid_gui_view_new(asid_gui gui, void *parent) {
 
 	ret->gui = gui;
 
-	ret->screen_maps[0] = (unsigned char*) malloc(inner_size_pixel);
-	ret->screen_maps[1] = (unsigned char*) malloc(inner_size_pixel);
-	ret->screen_maps[2] = (unsigned char*) malloc(inner_size_pixel);
-	ret->screen_maps[3] = (unsigned char*) malloc(inner_size_pixel);
-
-	if (!ret->screen_maps[0] || !ret->screen_maps[1] || !ret->screen_maps[2] || !ret->screen_maps[3]) {
-		for (int i = 0; i < 4; i++)
-			if (ret->screen_maps[i])
-				free(ret->screen_maps[i]);
+	ret->composed = (unsigned char*) malloc(inner_size_pixel);
+	if (ret->composed == NULL) {
+		free(ret);
 		return NULL;
 	}
-
-	memcpy(ret->screen_maps[0], screen_map_defaults[0], inner_size_pixel);
-	memcpy(ret->screen_maps[1], screen_map_defaults[1], inner_size_pixel);
-	memcpy(ret->screen_maps[2], screen_map_defaults[2], inner_size_pixel);
-	memcpy(ret->screen_maps[3], screen_map_defaults[3], inner_size_pixel);
-
-	ret->resized[0] = NULL;
-	ret->resized[1] = NULL;
-	ret->resized[2] = NULL;
-	ret->resized[3] = NULL;
+	ret->resized = NULL;
+	ret->ready = 0;
+	scale_table_init(&ret->cols);
+	scale_table_init(&ret->rows);
+	ret->art = NULL;
 
 	ret->scaleFactor = 1.f;
 	ret->scaleFactorInv = 1.f;
@@ -841,8 +1134,10 @@ asid_gui_view asid_gui_view_new(asid_gui gui, void *parent) {
 	ret->mouse_old_y = 0;
 
 	ret->screen_map_selected = 3;
+	ret->screen_map_selected_old = 3;
 
 	ret->modCutoffValue = 0.f;
+	view_on_param_set(ret, 3, gui->get_parameter(gui, 3));
 
 	// Redrawing state
 	ret->paramToRedraw[0] = 0;
@@ -850,11 +1145,12 @@ asid_gui_view asid_gui_view_new(asid_gui gui, void *parent) {
 	ret->paramToRedraw[2] = 0;
 	ret->modCutoffToRedraw = 0;
 	ret->toResize = 0;
+	ret->refine = 0;
+	ret->damage_w = 0;
 
 	ret->win = gui_window_new(gui->g, parent, width_default, height_default);
 	if (ret->win == NULL) {
-		for (int i = 0; i < 4; i++)
-			free(ret->screen_maps[i]);
+		free(ret->composed);
 		free(ret);
 		return NULL;
 	}
@@ -878,9 +1174,6 @@ asid_gui_view asid_gui_view_new(asid_gui gui, void *parent) {
 	gui_window_show (ret->win);
 
 	resize(ret, width_default, height_default);
-	draw_parameter_fixed(ret, 0);
-	draw_parameter_fixed(ret, 1);
-	draw_parameter_fixed(ret, 2);
 
 	return ret;
 }
@@ -894,12 +1187,18 @@ void asid_gui_view_free(asid_gui_view view) {
 			n = n->next;
 		n->next = view->next;
 	}
-
-	for (int i = 0; i < 4; i++) {
-		free(view->screen_maps[i]);
-		if (view->resized[i])
-			free(view->resized[i]);
+	if (view->gui->views == NULL) {
+		for (int i = 0; i < 4; i++)
+			view->gui->mailbox_set[i] = 0;
+		view->gui->mailbox_full = 0;
 	}
+
+	free(view->composed);
+	if (view->resized)
+		free(view->resized);
+	scale_table_free(&view->cols);
+	scale_table_free(&view->rows);
+	cache_release(view->art);
 	gui_window_free(view->win);
 	free(view);
 }
@@ -921,5 +1220,14 @@ uint32_t asid_gui_view_get_height(asid_gui_view view) {
 }
 
 void asid_gui_view_on_timeout(asid_gui_view view) {
+	mailbox_drain(view->gui);
+	if (view->refine && !view->toResize && --view->refine == 0 && view->ready)
+		refine(view);
 	draw(view);
 }
+
+char asid_gui_view_needs_redraw(asid_gui_view view) {
+	return view->gui->mailbox_full || view->toResize || view->screen_map_selected != view->screen_map_selected_old
+		|| view->paramToRedraw[0] || view->paramToRedraw[1] || view->paramToRedraw[2]
+		|| view->modCutoffToRedraw || view->refine;
+}
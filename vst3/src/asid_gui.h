@@ -39,7 +39,8 @@ void asid_gui_process_events(asid_gui gui);
 uint32_t asid_gui_get_default_width(asid_gui gui);
 uint32_t asid_gui_get_default_height(asid_gui gui);
 void *asid_gui_get_data(asid_gui gui);
-void asid_gui_on_param_set(asid_gui gui, uint32_t id, float value);
+char asid_gui_on_param_set(asid_gui gui, uint32_t id, float value);	// applied at the next asid_gui_view_on_timeout(), 1 = views have to be woken up
+int asid_gui_get_fd(asid_gui gui);	// readable when asid_gui_process_events() has something to do, -1 if not available
 
 asid_gui_view asid_gui_view_new(asid_gui gui, void *parent);
 void asid_gui_view_free(asid_gui_view view);
@@ -48,6 +49,7 @@ void *asid_gui_view_get_handle(asid_gui_view view);
 uint32_t asid_gui_view_get_width(asid_gui_view view);
 uint32_t asid_gui_view_get_height(asid_gui_view view);
 void asid_gui_view_on_timeout(asid_gui_view view);
+char asid_gui_view_needs_redraw(asid_gui_view view);	// whether asid_gui_view_on_timeout() would draw anything
 
 #ifdef __cplusplus
 }
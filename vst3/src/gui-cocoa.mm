@@ -141,6 +141,10 @@ void gui_stop (gui g) {
   [g->app stop:nullptr];
 }
 
+int gui_get_fd(gui g) {
+	return -1;
+}
+
 window gui_window_new(gui g, void* parent, uint32_t width, uint32_t height) { 
 
   window ret = (window) malloc(sizeof(_window));
@@ -0,0 +1,210 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Windows are just framebuffers in memory, for tests and benchmarks without
+// a display. Input comes from gui-offscreen.h, size changes are delivered by
+// gui_run() like a window system would.
+
+#include "gui.h"
+#include "gui-offscreen.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+struct _window {
+	gui		 g;
+	window		 next;
+	uint32_t	 width;
+	uint32_t	 height;
+	unsigned char	*pixels;	// BGRA
+	char		 resized;	// not delivered yet
+	uint64_t	 bytes_drawn;
+	uint32_t	 draws;
+	void		*data;
+	gui_cb		 resize_cb;
+	gui_cb		 mouse_press_cb;
+	gui_cb		 mouse_release_cb;
+	gui_cb		 mouse_move_cb;
+};
+
+struct _gui {
+	window		 windows;
+};
+
+gui gui_new() {
+	gui g = (gui) malloc(sizeof(struct _gui));
+	if (g == NULL)
+		return NULL;
+	g->windows = NULL;
+	return g;
+}
+
+void gui_free(gui g) {
+	free(g);
+}
+
+void gui_run(gui g, char single) {
+	for (window w = g->windows; w; w = w->next)
+		if (w->resized) {
+			w->resized = 0;
+			if (w->resize_cb)
+				((void(*)(window, uint32_t, uint32_t))w->resize_cb)(w, w->width, w->height);
+		}
+}
+
+void gui_stop(gui g) {
+}
+
+int gui_get_fd(gui g) {
+	return -1;
+}
+
+window gui_window_new(gui g, void* parent, uint32_t width, uint32_t height) {
+	window ret = (window) malloc(sizeof(struct _window));
+	if (ret == NULL)
+		return NULL;
+	ret->pixels = (unsigned char *) calloc((size_t)width * height, 4);
+	if (ret->pixels == NULL) {
+		free(ret);
+		return NULL;
+	}
+
+	ret->g = g;
+	ret->next = g->windows;
+	g->windows = ret;
+	ret->width = width;
+	ret->height = height;
+	ret->resized = 0;
+	ret->bytes_drawn = 0;
+	ret->draws = 0;
+	ret->data = NULL;
+	ret->resize_cb = NULL;
+	ret->mouse_press_cb = NULL;
+	ret->mouse_release_cb = NULL;
+	ret->mouse_move_cb = NULL;
+
+	return ret;
+}
+
+void gui_window_free(window w) {
+	window *n = &w->g->windows;
+	while (*n != w)
+		n = &(*n)->next;
+	*n = w->next;
+	free(w->pixels);
+	free(w);
+}
+
+void gui_window_draw(window w, unsigned char *data, uint32_t dx, uint32_t dy, uint32_t dw, uint32_t dh, uint32_t wx, uint32_t wy, uint32_t width, uint32_t height) {
+	if (dy + height > dh)
+		height = dh - dy;
+	if (wx + width > w->width)
+		width = wx < w->width ? w->width - wx : 0;
+	if (wy + height > w->height)
+		height = wy < w->height ? w->height - wy : 0;
+
+	for (uint32_t y = 0; y < height; y++)
+		memcpy(w->pixels + (((wy + y) * w->width + wx) << 2), data + (((dy + y) * dw + dx) << 2), width << 2);
+
+	w->bytes_drawn += (uint64_t)(width * height) << 2;
+	w->draws++;
+}
+
+void gui_window_resize(window w, uint32_t width, uint32_t height) {
+	if (width == w->width && height == w->height)
+		return;
+	unsigned char *pixels = (unsigned char *) calloc((size_t)width * height, 4);
+	if (pixels == NULL)
+		return;
+	free(w->pixels);
+	w->pixels = pixels;
+	w->width = width;
+	w->height = height;
+	w->resized = 1;
+}
+
+void *gui_window_get_handle(window w) {
+	return w;
+}
+
+uint32_t gui_window_get_width(window w) {
+	return w->width;
+}
+
+uint32_t gui_window_get_height(window w) {
+	return w->height;
+}
+
+void gui_window_show(window w) {
+}
+
+void gui_window_hide(window w) {
+}
+
+void gui_window_set_data(window w, void *data) {
+	w->data = data;
+}
+
+void *gui_window_get_data(window w) {
+	return w->data;
+}
+
+void gui_window_set_cb(window w, gui_cb_type type, gui_cb cb) {
+	switch (type) {
+	case GUI_CB_RESIZE:
+		w->resize_cb = cb;
+		break;
+	case GUI_CB_MOUSE_PRESS:
+		w->mouse_press_cb = cb;
+		break;
+	case GUI_CB_MOUSE_RELEASE:
+		w->mouse_release_cb = cb;
+		break;
+	case GUI_CB_MOUSE_MOVE:
+		w->mouse_move_cb = cb;
+		break;
+	}
+}
+
+void gui_offscreen_mouse_press(window w, int32_t x, int32_t y) {
+	if (w->mouse_press_cb)
+		((void(*)(window, int32_t, int32_t))w->mouse_press_cb)(w, x, y);
+}
+
+void gui_offscreen_mouse_release(window w, int32_t x, int32_t y) {
+	if (w->mouse_release_cb)
+		((void(*)(window, int32_t, int32_t))w->mouse_release_cb)(w, x, y);
+}
+
+void gui_offscreen_mouse_move(window w, int32_t x, int32_t y, uint32_t state) {
+	if (w->mouse_move_cb)
+		((void(*)(window, int32_t, int32_t, uint32_t))w->mouse_move_cb)(w, x, y, state);
+}
+
+const unsigned char *gui_offscreen_get_pixels(window w) {
+	return w->pixels;
+}
+
+uint64_t gui_offscreen_get_bytes_drawn(window w) {
+	return w->bytes_drawn;
+}
+
+uint32_t gui_offscreen_get_draws(window w) {
+	return w->draws;
+}
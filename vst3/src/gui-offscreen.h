@@ -0,0 +1,42 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#ifndef _GUI_OFFSCREEN_H
+#define _GUI_OFFSCREEN_H
+
+#include "gui.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Input, delivered right away
+void gui_offscreen_mouse_press(window w, int32_t x, int32_t y);
+void gui_offscreen_mouse_release(window w, int32_t x, int32_t y);
+void gui_offscreen_mouse_move(window w, int32_t x, int32_t y, uint32_t state);
+
+const unsigned char *gui_offscreen_get_pixels(window w);	// BGRA, width x height
+uint64_t gui_offscreen_get_bytes_drawn(window w);	// by gui_window_draw() since creation
+uint32_t gui_offscreen_get_draws(window w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -179,6 +179,10 @@ void gui_stop(gui g) {
 	g->keep_running = 0;
 }
 
+int gui_get_fd(gui g) {
+	return -1;
+}
+
 window gui_window_new(gui g, void* parent, uint32_t width, uint32_t height) {
 	window w = (window)malloc(sizeof(struct _window));
 	if (w == NULL)
@@ -20,7 +20,11 @@
 #include "gui.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <xcb/xcb.h>
+#include <xcb/shm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <poll.h>
 
 typedef struct _window {
@@ -31,6 +35,11 @@ typedef struct _window {
 	xcb_gcontext_t	 gc;
 	uint16_t	 width;
 	uint16_t	 height;
+	unsigned char	*image;		// server byte order, in MIT-SHM memory if image_seg != 0
+	uint32_t	 image_size;
+	xcb_shm_seg_t	 image_seg;
+	char		 image_busy;	// server might still be reading image
+	xcb_get_input_focus_cookie_t image_sync;
 	void		*data;
 	gui_cb		 resize_cb;
 	gui_cb		 mouse_press_cb;
@@ -45,6 +54,7 @@ typedef struct _gui {
 	xcb_visualtype_t	*visual;
 	xcb_atom_t		 xembed_info_atom;
 	window			 windows;
+	char			 shm;
 	char			 keep_running;
 } *gui;
 
@@ -61,7 +71,7 @@ gui gui_new() {
 	g->screen = xcb_setup_roots_iterator(xcb_get_setup(g->connection)).data;
 	g->setup = xcb_get_setup(g->connection);
 
-	xcb_visualtype_iterator_t visual_iter; xcb_intern_atom_reply_t* reply; // stupid C++ and its cross-initialization issues...
+	xcb_visualtype_iterator_t visual_iter; xcb_intern_atom_reply_t* reply; const xcb_query_extension_reply_t *shm; // stupid C++ and its cross-initialization issues...
 
 	xcb_depth_iterator_t depth_iter = xcb_screen_allowed_depths_iterator(g->screen);
 	xcb_depth_t *depth = NULL;
@@ -95,6 +105,10 @@ gui gui_new() {
 
 	g->windows = NULL;
 
+	// Only tells that the server supports it, attaching can still fail (e.g., remote display)
+	shm = xcb_get_extension_data(g->connection, &xcb_shm_id);
+	g->shm = shm != NULL && shm->present;
+
 	return g;
 
 err:
@@ -204,6 +218,10 @@ void gui_stop(gui g) {
 	g->keep_running = 0;
 }
 
+int gui_get_fd(gui g) {
+	return xcb_get_file_descriptor(g->connection);
+}
+
 #define XEMBED_MAPPED (1 << 0)
 
 window gui_window_new(gui g, void* p, uint32_t width, uint32_t height) {
@@ -247,6 +265,10 @@ window gui_window_new(gui g, void* p, uint32_t width, uint32_t height) {
 	ret->g = g;
 	ret->width = width;
 	ret->height = height;
+	ret->image = NULL;
+	ret->image_size = 0;
+	ret->image_seg = 0;
+	ret->image_busy = 0;
 	ret->data = NULL;
 	ret->resize_cb = NULL;
 	ret->mouse_press_cb = NULL;
@@ -256,6 +278,60 @@ window gui_window_new(gui g, void* p, uint32_t width, uint32_t height) {
 	return ret;
 }
 
+static void image_sync(window w) {
+	if (w->image_busy) {
+		free(xcb_get_input_focus_reply(w->g->connection, w->image_sync, NULL));
+		w->image_busy = 0;
+	}
+}
+
+static void image_free(window w) {
+	if (w->image == NULL)
+		return;
+	if (w->image_seg) {
+		xcb_shm_detach(w->g->connection, w->image_seg);
+		shmdt(w->image);
+		w->image_seg = 0;
+	} else
+		free(w->image);
+	w->image = NULL;
+	w->image_size = 0;
+}
+
+static char image_alloc(window w, uint32_t size) {
+	gui g = w->g;
+	image_sync(w);
+	image_free(w);
+
+	if (g->shm) {
+		int id = shmget(IPC_PRIVATE, size, IPC_CREAT | 0600);
+		if (id != -1) {
+			void *addr = shmat(id, NULL, 0);
+			if (addr != (void *) -1) {
+				xcb_shm_seg_t seg = xcb_generate_id(g->connection);
+				xcb_generic_error_t *err = xcb_request_check(g->connection, xcb_shm_attach_checked(g->connection, seg, id, 0));
+				shmctl(id, IPC_RMID, NULL); // goes away once both sides detach
+				if (err == NULL) {
+					w->image = (unsigned char *) addr;
+					w->image_size = size;
+					w->image_seg = seg;
+					return 1;
+				}
+				free(err);
+				shmdt(addr);
+			} else
+				shmctl(id, IPC_RMID, NULL);
+		}
+		g->shm = 0;
+	}
+
+	w->image = (unsigned char *) malloc(size);
+	if (w->image == NULL)
+		return 0;
+	w->image_size = size;
+	return 1;
+}
+
 void gui_window_free(window w) {
 	if (w->g->windows == w)
 		w->g->windows = w->next;
@@ -266,6 +342,8 @@ void gui_window_free(window w) {
 		n->next = w->next;
 	}
 
+	image_sync(w);
+	image_free(w);
 	xcb_free_gc(w->g->connection, w->gc);
 	xcb_free_pixmap(w->g->connection, w->pixmap);
 	xcb_destroy_window(w->g->connection, w->window);
@@ -274,40 +352,58 @@ void gui_window_free(window w) {
 }
 
 void gui_window_draw(window w, unsigned char *data, uint32_t dx, uint32_t dy, uint32_t dw, uint32_t dh, uint32_t wx, uint32_t wy, uint32_t width, uint32_t height) {
-	uint32_t bytes = 4 * width * height;
-	unsigned char *bgra = (unsigned char*) malloc(bytes);
-	if (bgra == NULL)
+	gui g = w->g;
+	if (dy + height > dh)
+		height = dh - dy;
+	const uint32_t stride = width << 2;
+	const uint32_t bytes = stride * height;
+	if (bytes == 0)
 		return;
 
-	uint32_t i = 0;
-	uint32_t o = (dw * dy + dx) << 2;
-	uint32_t p = (dw - width) << 2;
-	if (w->g->setup->image_byte_order == XCB_IMAGE_ORDER_MSB_FIRST) {
-		for (uint32_t y = dy; y < dy + height && y < dh; y++) {
-			for (uint32_t x = dx; x < dx + width; x++, o += 4) {
-				bgra[i++] = data[o + 2];
-				bgra[i++] = data[o + 1];
-				bgra[i++] = data[o];
-				i++;
+	image_sync(w);
+	if (bytes > w->image_size) {
+		// At least the whole window, so that it doesn't grow a bit at a time
+		const uint32_t window_bytes = ((uint32_t) w->width * w->height) << 2;
+		if (!image_alloc(w, bytes > window_bytes ? bytes : window_bytes))
+			return;
+	}
+
+	// data is BGRA (0xXXRRGGBB little endian), which is what 24-bit TrueColor
+	// servers expect in LSB first order, and byte-swapped in MSB first order
+	const unsigned char *s = data + ((dw * dy + dx) << 2);
+	unsigned char *d = w->image;
+	if (g->setup->image_byte_order == XCB_IMAGE_ORDER_MSB_FIRST) {
+		for (uint32_t y = 0; y < height; y++, s += dw << 2)
+			for (uint32_t x = 0; x < stride; x += 4, d += 4) {
+				d[0] = s[x + 3];
+				d[1] = s[x + 2];
+				d[2] = s[x + 1];
+				d[3] = s[x];
 			}
-			o += p;
-		}
 	} else {
-		for (uint32_t y = dy; y < dy + height; y++) {
-			for (uint32_t x = dx; x < dx + width; x++, o += 4) {
-				bgra[i++] = data[o];
-				bgra[i++] = data[o + 1];
-				bgra[i++] = data[o + 2];
-				i++;
-			}
-			o += p;
-		}
+		for (uint32_t y = 0; y < height; y++, s += dw << 2, d += stride)
+			memcpy(d, s, stride);
 	}
 
-	xcb_put_image(w->g->connection, XCB_IMAGE_FORMAT_Z_PIXMAP, w->pixmap, w->gc, width, height, wx, wy, 0, w->g->screen->root_depth, bytes, bgra);
-	free(bgra);
-	xcb_copy_area(w->g->connection, w->pixmap, w->window, w->gc, wx, wy, wx, wy, width, height);
-	xcb_flush(w->g->connection);
+	if (w->image_seg) {
+		xcb_shm_put_image(g->connection, w->pixmap, w->gc, width, height, 0, 0, width, height, wx, wy,
+				  g->screen->root_depth, XCB_IMAGE_FORMAT_Z_PIXMAP, 0, w->image_seg, 0);
+		// Round trip to know when the server is done with image, only waited for before writing again
+		w->image_sync = xcb_get_input_focus(g->connection);
+		w->image_busy = 1;
+	} else {
+		// Split in requests that fit the maximum request length
+		const uint32_t max_bytes = (xcb_get_maximum_request_length(g->connection) << 2) - sizeof(xcb_put_image_request_t);
+		uint32_t rows = max_bytes / stride;
+		if (rows == 0)
+			rows = 1;
+		for (uint32_t y = 0; y < height; y += rows) {
+			const uint32_t n = height - y < rows ? height - y : rows;
+			xcb_put_image(g->connection, XCB_IMAGE_FORMAT_Z_PIXMAP, w->pixmap, w->gc, width, n, wx, wy + y, 0, g->screen->root_depth, n * stride, w->image + y * stride);
+		}
+	}
+	xcb_copy_area(g->connection, w->pixmap, w->window, w->gc, wx, wy, wx, wy, width, height);
+	xcb_flush(g->connection);
 }
 
 void *gui_window_get_handle(window w) {
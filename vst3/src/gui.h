@@ -41,6 +41,7 @@ gui gui_new();
 void gui_free(gui g);
 void gui_run(gui g, char single);
 void gui_stop(gui g);
+int gui_get_fd(gui g);	// readable when there are events to process, -1 if not available
 
 window gui_window_new(gui g, void* parent, uint32_t width, uint32_t height);
 void gui_window_free(window w);
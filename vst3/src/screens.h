@@ -0,0 +1,1014 @@
+// Generated from c64/*.dat by c64/Makefile, do not edit
+static const unsigned char bitmap_dat[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x0f, 0x0f,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x10, 0x08, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x33,
+  0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0e,
+  0x02, 0x02, 0x01, 0x03, 0x0d, 0x70, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x80, 0x80, 0x0f, 0x30, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+  0xc0, 0x30, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0xfe, 0x41, 0x40, 0x40,
+  0x40, 0x41, 0x42, 0x7c, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x01, 0x01,
+  0x60, 0x60, 0x60, 0x90, 0x90, 0x90, 0x08, 0xf8, 0x0f, 0x10, 0x20, 0x20,
+  0x20, 0x10, 0x0c, 0x03, 0xcf, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x42, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7f, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x21, 0x3e, 0x00, 0x83, 0x44, 0x44, 0x48, 0x88, 0x08, 0x08,
+  0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x85, 0x84,
+  0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08,
+  0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x03, 0x03, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0xfc, 0xfc, 0x0f, 0x0f,
+  0x00, 0x00, 0xfc, 0xfc, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0x3c, 0x3c, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x18, 0x38, 0x18, 0x18, 0x18, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x18, 0x00, 0x3c, 0x66, 0x6e, 0x76, 0x66, 0x66, 0x3c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x3c, 0x66, 0x6e, 0x76,
+  0x66, 0x66, 0x3c, 0x00, 0x80, 0x81, 0x86, 0xb8, 0xc0, 0x40, 0x20, 0x20,
+  0x30, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x80, 0x40, 0x40, 0x30, 0x0f, 0x00, 0x00, 0x04, 0x04, 0x08, 0x08,
+  0x30, 0xc0, 0x00, 0x00, 0x48, 0x44, 0x42, 0x41, 0x40, 0xe0, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x04, 0x84, 0x4e, 0x00, 0x00, 0x04, 0x04, 0x04, 0x02,
+  0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x00, 0x00,
+  0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0xe0, 0x00, 0x00, 0x24, 0x22, 0x21, 0x20, 0x20, 0x70, 0x00, 0x00,
+  0x08, 0x08, 0x04, 0x84, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xfc, 0x00, 0x00, 0x44, 0x44, 0x84, 0x84, 0x04, 0x0e, 0x00, 0x00,
+  0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0xa0,
+  0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+  0x03, 0x03, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0xfc, 0xfc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
+  0xfc, 0xfc, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00,
+  0x0f, 0x0f, 0x3c, 0x3c, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x06, 0x0c, 0x30, 0x60, 0x7e, 0x00,
+  0x3c, 0x66, 0x6e, 0x76, 0x66, 0x66, 0x3c, 0x00, 0x3c, 0x66, 0x06, 0x0c,
+  0x30, 0x60, 0x7e, 0x00, 0x3c, 0x66, 0x06, 0x0c, 0x30, 0x60, 0x7e, 0x00,
+  0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x6e, 0x76,
+  0x66, 0x66, 0x3c, 0x00, 0x3c, 0x66, 0x60, 0x7c, 0x66, 0x66, 0x3c, 0x00,
+  0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0x6e, 0x76,
+  0x66, 0x66, 0x3c, 0x00, 0x06, 0x0e, 0x1e, 0x66, 0x7f, 0x06, 0x06, 0x00,
+  0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x7f, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x60, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x3c, 0x00, 0x80, 0x00, 0x00, 0x00, 0x38, 0xff, 0xd7, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x81, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x81,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+  0x0f, 0x1f, 0x3f, 0x7f, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x81, 0x42, 0x24, 0x00, 0x00, 0x24, 0x42, 0x81, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0xf8, 0xe0,
+  0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x81, 0x00, 0x00,
+  0x81, 0x8f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x80, 0x00, 0x02, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x81, 0x42, 0x24, 0x18,
+  0x18, 0x24, 0x42, 0x81, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7f, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xf8, 0xf0, 0xe0,
+  0xe0, 0xc0, 0x80, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x81, 0x42, 0x3c, 0x3c, 0x3c, 0x3c, 0x42, 0x81,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07,
+  0x0f, 0x1f, 0x1f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x81, 0x5a, 0x3c, 0x7e, 0x7e, 0x3c, 0x5a, 0x81, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x3f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x03, 0x03, 0x07, 0x07, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4c, 0xd8, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x99, 0x5a, 0x3c, 0xff,
+  0xff, 0x3c, 0x5a, 0x99, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3f, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80,
+  0x00, 0x00, 0x10, 0x00, 0x04, 0x60, 0x70, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x0f, 0x0f, 0x1f, 0x1f, 0x20, 0x20, 0x00, 0x00, 0xf0, 0xc0, 0xc0, 0xef,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x06, 0x0c, 0x1c, 0x38,
+  0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x07, 0x05, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x99, 0x5a, 0x18, 0xff, 0xff, 0x18, 0x5a, 0x99,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x86, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x01, 0x07, 0x07,
+  0x02, 0x02, 0x00, 0x00, 0x86, 0x97, 0x9f, 0x9f, 0x47, 0x41, 0xe0, 0x38,
+  0x80, 0x80, 0x98, 0x9c, 0xee, 0xe0, 0x60, 0xe0, 0x00, 0x00, 0x00, 0x58,
+  0x1c, 0x00, 0x00, 0x01, 0xe0, 0xe0, 0x80, 0x80, 0x80, 0x80, 0x00, 0x42,
+  0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xc0, 0x90,
+  0xc0, 0xe3, 0xff, 0xff, 0x40, 0x00, 0x00, 0x2c, 0xc1, 0xf3, 0xff, 0xff,
+  0xce, 0x1f, 0x1f, 0x1c, 0x00, 0x00, 0x40, 0x80, 0x7f, 0x13, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x99, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x99, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0,
+  0xe0, 0xf0, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x7e, 0xff,
+  0x82, 0x80, 0x01, 0x0f, 0x07, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x18, 0x18, 0x18, 0xff,
+  0xff, 0x18, 0x18, 0x18, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0f, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x0f, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x18, 0x18, 0x3c, 0xff, 0xff, 0x3c, 0x18, 0x18,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x0f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x18, 0x18, 0x7e, 0xff, 0xff, 0x7e, 0x18, 0x18, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3c, 0x07, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xb8, 0xd0, 0x00, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1f, 0x00,
+  0x00, 0x00, 0x00, 0x73, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xf3,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf8, 0xff, 0xff, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x18, 0x3c, 0x7e, 0xff,
+  0xff, 0x7e, 0x3c, 0x18, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x07, 0x0e, 0x1c, 0x11,
+  0x00, 0x00, 0x20, 0x10, 0x31, 0x39, 0x7b, 0x77, 0x00, 0x40, 0x00, 0x40,
+  0x87, 0x86, 0x84, 0x84, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x30,
+  0x00, 0x80, 0x90, 0x90, 0x12, 0x90, 0x90, 0x82, 0x0f, 0x1b, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf3, 0xa1, 0x8a, 0x80, 0x0c, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x7e, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x7e, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0c, 0x09, 0x0d, 0x0c,
+  0x18, 0x18, 0x12, 0x12, 0x87, 0xef, 0x27, 0x47, 0xc3, 0xc3, 0x23, 0x22,
+  0x10, 0x08, 0x18, 0x00, 0x40, 0x80, 0x02, 0xc3, 0x12, 0x00, 0x00, 0x00,
+  0x20, 0xa0, 0xa0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7e, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x7e, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22,
+  0x04, 0x24, 0x00, 0x00, 0x08, 0x88, 0x90, 0x20, 0x39, 0x39, 0x3b, 0x3e,
+  0x3a, 0x30, 0x20, 0x30, 0x9f, 0x9f, 0x1f, 0x1d, 0x1c, 0x2c, 0x2c, 0x0c,
+  0x40, 0x00, 0x01, 0x23, 0x33, 0x38, 0x31, 0x23, 0x20, 0x00, 0x01, 0x00,
+  0x00, 0x1c, 0x5d, 0x78, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x03, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x03, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x03, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0,
+  0xe0, 0xe0, 0xc0, 0xc0, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x80, 0xe7,
+  0x62, 0x6e, 0x4a, 0xd9, 0x53, 0x16, 0x96, 0x96, 0x00, 0x08, 0x8a, 0x0d,
+  0x18, 0x3c, 0x35, 0x7d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1b, 0x07,
+  0x00, 0x30, 0x30, 0x20, 0xe0, 0xe0, 0xe2, 0x82, 0x68, 0x00, 0x84, 0x62,
+  0x20, 0x30, 0x98, 0x00, 0x82, 0xc0, 0x00, 0x00, 0x00, 0x82, 0x00, 0x02,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff,
+  0x39, 0x99, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x98, 0x9e, 0x9e, 0x9e,
+  0xff, 0xff, 0xff, 0xff, 0x1c, 0x79, 0x79, 0x79, 0xff, 0xff, 0xff, 0xff,
+  0x38, 0x99, 0x99, 0x98, 0xff, 0xff, 0xff, 0xff, 0x18, 0xf9, 0xf9, 0x78,
+  0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x81, 0xff,
+  0x81, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0x9f, 0xff, 0xc3, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x81, 0xff,
+  0x81, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0x9f, 0xff, 0xc3, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc2, 0xc2, 0x91, 0x91, 0x85, 0xa5,
+  0xe5, 0x01, 0x01, 0xc1, 0xe2, 0xea, 0xea, 0xf1, 0xa6, 0xfe, 0x62, 0x22,
+  0x22, 0xe0, 0xa8, 0xb0, 0x58, 0x10, 0x00, 0x20, 0x20, 0x28, 0x60, 0x60,
+  0x46, 0x42, 0x40, 0x12, 0x12, 0x02, 0x00, 0x00, 0x82, 0xc0, 0xe0, 0xe0,
+  0xe0, 0xc8, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01, 0x00,
+  0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0xf9, 0xf9, 0xfc, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0x99, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x9e, 0x9e, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0x7c, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfc, 0xf9, 0xf8,
+  0xf9, 0xf9, 0xf9, 0xff, 0x79, 0x38, 0x98, 0x19, 0x99, 0x99, 0x99, 0xff,
+  0xcc, 0x89, 0x09, 0x49, 0xc9, 0xc9, 0xcc, 0xff, 0x39, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x3c, 0xff, 0x99, 0x98, 0x98, 0x98, 0x99, 0x99, 0x39, 0xff,
+  0x98, 0x9e, 0x1e, 0x1e, 0x1e, 0x9e, 0x9e, 0xff, 0x1f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc3, 0x99, 0x9f, 0xc3, 0xf9, 0x99, 0xc3, 0xff,
+  0x83, 0x99, 0x99, 0x83, 0x9f, 0x9f, 0x9f, 0xff, 0x81, 0x9f, 0x9f, 0x87,
+  0x9f, 0x9f, 0x81, 0xff, 0x81, 0x9f, 0x9f, 0x87, 0x9f, 0x9f, 0x81, 0xff,
+  0x87, 0x93, 0x99, 0x99, 0x99, 0x93, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x03, 0x02, 0x06, 0x06, 0x04, 0x24, 0x0a, 0x2a, 0x8a, 0x82,
+  0x0a, 0x0a, 0x42, 0x07, 0xb0, 0xa0, 0xd0, 0xf4, 0xdc, 0xc8, 0xd8, 0x9c,
+  0xe0, 0xc8, 0x24, 0xc4, 0xc4, 0xe4, 0xe6, 0xe7, 0x00, 0x00, 0x0c, 0x08,
+  0x0f, 0x26, 0x04, 0x0c, 0x80, 0x00, 0x00, 0x08, 0x01, 0x11, 0x25, 0x61,
+  0x00, 0x00, 0x00, 0x04, 0x14, 0x14, 0x04, 0x02, 0x0c, 0x4c, 0x0c, 0x8c,
+  0xc4, 0xc4, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x03, 0x03, 0x01, 0x02, 0x02, 0x07, 0x07, 0x2c, 0x2d, 0xc4, 0xc5,
+  0xce, 0x48, 0x4a, 0x08, 0x06, 0x06, 0x0e, 0x9e, 0x0e, 0x0e, 0x0e, 0x0c,
+  0x67, 0x42, 0x62, 0x62, 0x47, 0x42, 0x5b, 0xdb, 0x10, 0x11, 0x18, 0x34,
+  0x75, 0x7c, 0xf4, 0xf7, 0x0c, 0x06, 0x1c, 0xb4, 0x10, 0x00, 0x20, 0x70,
+  0x09, 0x09, 0x6d, 0x6d, 0x20, 0x02, 0x01, 0x5d, 0x4a, 0x02, 0x02, 0x12,
+  0x00, 0x61, 0xc3, 0xc3, 0xe0, 0xa3, 0x03, 0x91, 0x91, 0x00, 0x12, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x0f,
+  0x0f, 0x0c, 0x0e, 0x1f, 0x46, 0x44, 0x66, 0xa6, 0xa2, 0xa4, 0x9e, 0xd6,
+  0x00, 0x00, 0x14, 0x35, 0x58, 0x54, 0xd0, 0xd4, 0xf9, 0xe1, 0x21, 0x2d,
+  0x05, 0x00, 0x0d, 0x09, 0x20, 0x22, 0x23, 0x23, 0x02, 0x02, 0x26, 0x00,
+  0x10, 0x14, 0x06, 0x2c, 0x18, 0x48, 0x40, 0x40, 0x31, 0xd1, 0x11, 0x11,
+  0xd1, 0xd1, 0x51, 0x50, 0xc1, 0x85, 0x85, 0x85, 0xc6, 0xc6, 0xc4, 0xc0,
+  0x18, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x2e, 0x3e
+};
+static const unsigned char colormap1_dat[] = {
+  0x11, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x21, 0x21, 0x21, 0x21, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x51,
+  0x15, 0xb1, 0xb1, 0x61, 0x61, 0x41, 0x14, 0x21, 0x21, 0x11, 0x11, 0x11,
+  0x11, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x21, 0x21, 0x21,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x11, 0x51, 0x51, 0x11, 0x11, 0x61, 0x61, 0x41, 0x41, 0x21,
+  0x21, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x01, 0x01, 0x51,
+  0x21, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0xd1, 0xd1, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xd1, 0x1d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xd1, 0x1d, 0xdd, 0xdd, 0xdd, 0x5d,
+  0xdd, 0xd5, 0x5d, 0xdd, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1d, 0x1d,
+  0xdd, 0xdd, 0xdd, 0x5d, 0xdd, 0xdd, 0xdd, 0xdd, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0xd1, 0xdd, 0xdd, 0xdd, 0xdd, 0x5d, 0xdd, 0xdd, 0xdd, 0x5d, 0xdd,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xd1, 0x1d, 0xdd, 0x5d, 0xdd, 0x5d, 0x5d, 0xdd,
+  0xdd, 0xdd, 0x5d, 0x5d, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1d, 0x5d, 0x5d, 0x5d,
+  0xdd, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xd5, 0xd5, 0xd5, 0x5d, 0x5d, 0xd5, 0xd5, 0x5d, 0x5d, 0xd5, 0xd5, 0xd5,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0xd5, 0x5d, 0x5d, 0x5d, 0xd5, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x55, 0x55, 0xd5,
+  0x55, 0xd5, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x51, 0x15, 0x55, 0x55, 0x55, 0xd5, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x15, 0x55, 0xd5, 0xd5, 0x5d, 0xd5,
+  0xd5, 0xd5, 0xd5, 0xd5, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x91,
+  0x91, 0x91, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x81, 0x78, 0x78, 0x78, 0x78, 0x98, 0x98,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x17, 0x87, 0x87,
+  0x78, 0x78, 0x78, 0x78, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x71, 0x17, 0x17, 0x87, 0x87, 0x87, 0x78, 0x78, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0x87,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xbb, 0xbb, 0x11, 0x11, 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xbb,
+  0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x87, 0x87, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11,
+  0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71,
+  0x17, 0x71, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x71, 0x17, 0x71, 0x71, 0x71, 0x17, 0x17, 0x17, 0x87,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x71, 0x71, 0x71, 0x87,
+  0x87, 0x17, 0x17, 0x87
+};
+static const unsigned char colormap2_dat[] = {
+  0x11, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x21, 0x21, 0x21, 0x21, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x61,
+  0x16, 0xb1, 0xb1, 0x41, 0x41, 0x21, 0x12, 0x51, 0x51, 0x11, 0x11, 0x11,
+  0x11, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x21, 0x21, 0x21,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x11, 0x61, 0x61, 0x11, 0x11, 0x41, 0x41, 0x21, 0x21, 0x51,
+  0x51, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x61, 0x01, 0x01, 0x61,
+  0x21, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0xe1, 0xe1, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xe1, 0x1e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xe1, 0x1e, 0xee, 0xee, 0xee, 0x6e,
+  0xee, 0xe6, 0x6e, 0xee, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x1e,
+  0xee, 0xee, 0xee, 0x6e, 0xee, 0xee, 0xee, 0xee, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0xe1, 0xee, 0xee, 0xee, 0xee, 0x6e, 0xee, 0xee, 0xee, 0x6e, 0xee,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xe1, 0x1e, 0xee, 0x6e, 0xee, 0x6e, 0x6e, 0xee,
+  0xee, 0xee, 0x6e, 0x6e, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x6e, 0x6e, 0x6e,
+  0xee, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xe6, 0xe6, 0xe6, 0x6e, 0x6e, 0xe6, 0xe6, 0x6e, 0x6e, 0xe6, 0xe6, 0xe6,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xe6, 0x66, 0xe6, 0x6e, 0x6e, 0x6e, 0xe6, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66, 0xe6,
+  0x66, 0xe6, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x61, 0x16, 0x66, 0x66, 0x66, 0xe6, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x61, 0x16, 0x66, 0xe6, 0xe6, 0x6e, 0xe6,
+  0xe6, 0xe6, 0xe6, 0xe6, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x91,
+  0x91, 0x91, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x81, 0x78, 0x78, 0x78, 0x78, 0x98, 0x98,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x17, 0x87, 0x87,
+  0x78, 0x78, 0x78, 0x78, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x71, 0x17, 0x17, 0x87, 0x87, 0x87, 0x78, 0x78, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0x87,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xbb, 0xbb, 0x11, 0x11, 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xbb,
+  0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x87, 0x87, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11,
+  0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71,
+  0x17, 0x71, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x71, 0x17, 0x71, 0x71, 0x71, 0x17, 0x17, 0x17, 0x87,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x71, 0x71, 0x71, 0x87,
+  0x87, 0x17, 0x17, 0x87
+};
+static const unsigned char colormap3_dat[] = {
+  0x11, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x21, 0x21, 0x21, 0x21, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x41,
+  0x14, 0xb1, 0xb1, 0x21, 0x21, 0x51, 0x15, 0x61, 0x61, 0x11, 0x11, 0x11,
+  0x11, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x21, 0x21, 0x21,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x11, 0x41, 0x41, 0x11, 0x11, 0x21, 0x21, 0x51, 0x51, 0x61,
+  0x61, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x01, 0x01, 0x41,
+  0x21, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x31, 0x31, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x31, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x13, 0x33, 0x33, 0x33, 0x43,
+  0x33, 0x34, 0x43, 0x33, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13,
+  0x33, 0x33, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x31, 0x33, 0x33, 0x33, 0x33, 0x43, 0x33, 0x33, 0x33, 0x43, 0x33,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x31, 0x13, 0x33, 0x43, 0x33, 0x43, 0x43, 0x33,
+  0x33, 0x33, 0x43, 0x43, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x43, 0x43, 0x43,
+  0x33, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x34, 0x34, 0x34, 0x43, 0x43, 0x34, 0x34, 0x43, 0x43, 0x34, 0x34, 0x34,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x34, 0x44, 0x34, 0x43, 0x43, 0x43, 0x34, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x34,
+  0x44, 0x34, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x41, 0x14, 0x44, 0x44, 0x44, 0x34, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x14, 0x44, 0x34, 0x34, 0x43, 0x34,
+  0x34, 0x34, 0x34, 0x34, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x91,
+  0x91, 0x91, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x81, 0x78, 0x78, 0x78, 0x78, 0x98, 0x98,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x17, 0x87, 0x87,
+  0x78, 0x78, 0x78, 0x78, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x71, 0x17, 0x17, 0x87, 0x87, 0x87, 0x78, 0x78, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0x87,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xbb, 0xbb, 0x11, 0x11, 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xbb,
+  0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x87, 0x87, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11,
+  0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71,
+  0x17, 0x71, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x71, 0x17, 0x71, 0x71, 0x71, 0x17, 0x17, 0x17, 0x87,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x71, 0x71, 0x71, 0x87,
+  0x87, 0x17, 0x17, 0x87
+};
+static const unsigned char colormap4_dat[] = {
+  0x11, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x21, 0x21, 0x21, 0x21, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x21,
+  0x12, 0xb1, 0xb1, 0x51, 0x51, 0x61, 0x16, 0x41, 0x41, 0x11, 0x11, 0x11,
+  0x11, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x21, 0x21, 0x21,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x11, 0x21, 0x21, 0x11, 0x11, 0x51, 0x51, 0x61, 0x61, 0x41,
+  0x41, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x01, 0x01, 0x21,
+  0x21, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0xa1, 0xa1, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xa1, 0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa1, 0x1a, 0xaa, 0xaa, 0xaa, 0x2a,
+  0xaa, 0xa2, 0x2a, 0xaa, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x1a,
+  0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0xa1, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xa1, 0x1a, 0xaa, 0x2a, 0xaa, 0x2a, 0x2a, 0xaa,
+  0xaa, 0xaa, 0x2a, 0x2a, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x2a, 0x2a, 0x2a,
+  0xaa, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xa2, 0xa2, 0xa2, 0x2a, 0x2a, 0xa2, 0xa2, 0x2a, 0x2a, 0xa2, 0xa2, 0xa2,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xa2, 0x22, 0xa2, 0x2a, 0x2a, 0x2a, 0xa2, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0xa2,
+  0x22, 0xa2, 0xa2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x21, 0x12, 0x22, 0x22, 0x22, 0xa2, 0xa2, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x12, 0x22, 0xa2, 0xa2, 0x2a, 0xa2,
+  0xa2, 0xa2, 0xa2, 0xa2, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x91,
+  0x91, 0x91, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0xb1, 0xb1,
+  0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x81, 0x78, 0x78, 0x78, 0x78, 0x98, 0x98,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1,
+  0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x17, 0x87, 0x87,
+  0x78, 0x78, 0x78, 0x78, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0xb1, 0xbb, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x71, 0x17, 0x17, 0x87, 0x87, 0x87, 0x78, 0x78, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0x87,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xbb, 0xbb, 0x11, 0x11, 0xbb, 0xbb, 0xb1, 0xb1, 0xb1, 0xbb,
+  0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x17, 0x17, 0x17,
+  0x17, 0x17, 0x87, 0x87, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11,
+  0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xbb, 0xb1,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xbb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71,
+  0x17, 0x71, 0x17, 0x17, 0x17, 0x17, 0x17, 0x87, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+  0x11, 0x11, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x71, 0x17, 0x71, 0x71, 0x71, 0x17, 0x17, 0x17, 0x87,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x71, 0x71, 0x71, 0x87,
+  0x87, 0x17, 0x17, 0x87
+};
@@ -25,6 +25,9 @@
 #define IO_MONO			1
 #define IO_STEREO		(1<<1)
 
+// From the processor, when activated with a different latency than last reported
+#define LATENCY_CHANGED_MSG_ID	"LatencyChanged"
+
 struct config_io_bus {
 	const char	*name;
 	char		 out;
@@ -76,13 +79,16 @@ static struct config_io_bus config_buses_out[NUM_BUSES_OUT] = {
 	{ "Audio out", 1, 0, 0, IO_MONO }
 };
 
-#define NUM_PARAMETERS	4
+#define NUM_PARAMETERS	7
 
 static struct config_parameter config_parameters[NUM_PARAMETERS] = {
 	{ "Cutoff", "Cutoff", "", 0, 0, 0, 1.f },
 	{ "LFO Amount", "LFO Amt", "%", 0, 0, 0, 0.f },
 	{ "LFO Speed", "LFO Speed", "", 0, 0, 0, 0.5f },
 	{ "Modulated Cutoff", "Mod Cutoff", "", 1, 0, 0, 0.f },
+	{ "Envelope Amount", "Env Amt", "%", 0, 0, 0, 0.f },
+	{ "Envelope Attack", "Env Att", "", 0, 0, 0, 0.3f },
+	{ "Envelope Release", "Env Rel", "", 0, 0, 0, 0.5f },
 };
 
 // Internal API
@@ -97,6 +103,11 @@ static struct config_parameter config_parameters[NUM_PARAMETERS] = {
 #define P_PROCESS			asid_process
 #define P_SET_PARAMETER			asid_set_parameter
 #define P_GET_PARAMETER			asid_get_parameter
+#define P_SET_QUALITY			asid_set_quality
+#define P_QUALITY_REALTIME		asid_quality_fast	// also used in kPrefetch mode
+#define P_QUALITY_OFFLINE		asid_quality_reference
+#define P_SET_DECIMATION		asid_set_decimation	// on, but off in kOffline mode, see P_QUALITY_OFFLINE
+#define P_GET_LATENCY			asid_get_latency	// changes signaled with LATENCY_CHANGED_MSG_ID
 
 #include "asid_gui.h"
 
@@ -108,6 +119,7 @@ static struct config_parameter config_parameters[NUM_PARAMETERS] = {
 #define PGUI_GET_DEFAULT_HEIGHT		asid_gui_get_default_height
 #define PGUI_GET_DATA			asid_gui_get_data
 #define PGUI_ON_PARAM_SET		asid_gui_on_param_set
+#define PGUI_GET_FD			asid_gui_get_fd
 
 #define PGUIVIEW_TYPE			asid_gui_view
 #define PGUIVIEW_NEW			asid_gui_view_new
@@ -117,5 +129,6 @@ static struct config_parameter config_parameters[NUM_PARAMETERS] = {
 #define PGUIVIEW_GET_WIDTH		asid_gui_view_get_width
 #define PGUIVIEW_GET_HEIGHT		asid_gui_view_get_height
 #define PGUIVIEW_ON_TIMEOUT 		asid_gui_view_on_timeout
+#define PGUIVIEW_NEEDS_REDRAW		asid_gui_view_needs_redraw
 
 #endif
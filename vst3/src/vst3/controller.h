@@ -21,6 +21,7 @@
 #define _VST3_CONTROLLER_H
 
 #include "config.h"
+#include "meter.h"
 
 #include "public.sdk/source/vst/vsteditcontroller.h"
 
@@ -38,9 +39,17 @@ public:
 	IPlugView * PLUGIN_API createView(const char *name) SMTG_OVERRIDE;
 	tresult PLUGIN_API setComponentState(IBStream *state) SMTG_OVERRIDE;
 	tresult PLUGIN_API setParamNormalized(ParamID tag, ParamValue value) SMTG_OVERRIDE;
+	tresult PLUGIN_API connect(IConnectionPoint *other) SMTG_OVERRIDE;
+	tresult PLUGIN_API disconnect(IConnectionPoint *other) SMTG_OVERRIDE;
+	tresult PLUGIN_API notify(IMessage *message) SMTG_OVERRIDE;
+
+	void pollMeter();	// from the UI thread, at display rate
 
 private:
+	friend class PlugView;
+
 	PGUI_TYPE pgui = nullptr;
+	Meter *meter = nullptr;	// processor's, if in the same process
 };
 
 #endif
@@ -18,20 +18,52 @@
  */
 
 #include "controller.h"
+#include "state.h"
 
 #include "pluginterfaces/base/conststringtable.h"
+#include "pluginterfaces/vst/ivstmessage.h"
 #include "base/source/fstreamer.h"
 
+class PlugView;
+
 class LinuxTimerHandler final : public Linux::ITimerHandler {
 public:
-	void PLUGIN_API onTimer() {
-		PGUI_PROCESS_EVENTS(pgui);
-		PGUIVIEW_ON_TIMEOUT(pgui_view);
+	void PLUGIN_API onTimer();
+
+	void setView(PlugView *view) {
+		this->view = view;
+	}
+	
+	uint32 PLUGIN_API addRef() {
+		refCount++;
+		return refCount;
 	}
 
-	void setPGUIData(PGUI_TYPE pgui, PGUIVIEW_TYPE pgui_view) {
-		this->pgui = pgui;
-		this->pgui_view = pgui_view;
+	uint32 PLUGIN_API release() {
+		refCount--;
+		if (refCount == 0) {
+			delete this;
+			return 0;
+		}
+		return refCount;
+	}
+
+	tresult PLUGIN_API queryInterface (const Steinberg::TUID, void** obj) {
+		*obj = nullptr;
+		return kNotImplemented;
+	}
+
+private:
+	uint32 refCount = 1;
+	PlugView *view;
+};
+
+class LinuxEventHandler final : public Linux::IEventHandler {
+public:
+	void PLUGIN_API onFDIsSet(Linux::FileDescriptor fd);
+
+	void setView(PlugView *view) {
+		this->view = view;
 	}
 	
 	uint32 PLUGIN_API addRef() {
@@ -55,13 +87,19 @@ public:
 
 private:
 	uint32 refCount = 1;
-	PGUI_TYPE pgui;
-	PGUIVIEW_TYPE pgui_view;
+	PlugView *view;
 };
 
+// Input is handled as soon as the connection fd is readable, while the timer
+// only runs to redraw (at most once per period) and stops once idle, or slows
+// down to check for new meter values
+#define REDRAW_PERIOD_MS	20
+#define METER_IDLE_PERIOD_MS	100
+
 class PlugView : public EditorView {
 public:
-	PlugView(EditController *controller, PGUI_TYPE pgui) : EditorView(controller, nullptr) {
+	PlugView(Controller *controller, PGUI_TYPE pgui) : EditorView(controller, nullptr) {
+		this->controller = controller;
 		this->pgui = pgui;
 		pgui_view_created = 0;
 	}
@@ -77,13 +115,30 @@ public:
 		pgui_view = PGUIVIEW_NEW(pgui, &parent);
 		pgui_view_created = 1;
 		plugFrame->queryInterface(Linux::IRunLoop::iid, (void **)&runLoop);
-		timer.setPGUIData(pgui, pgui_view);
-		runLoop->registerTimer(&timer, 20);
+		timer.setView(this);
+		eventHandler.setView(this);
+		timerPeriod = 0;
+
+		next = views;
+		views = this;
+
+		fd = PGUI_GET_FD(pgui);
+		if (fd != -1 && runLoop->registerEventHandler(&eventHandler, fd) != kResultTrue)
+			fd = -1;
+		startTimer(); // first draw, and polling forever if fd == -1
 		return kResultTrue;
 	}
 
 	tresult PLUGIN_API removed() {
-		runLoop->unregisterTimer(&timer);
+		if (fd != -1)
+			runLoop->unregisterEventHandler(&eventHandler);
+		setTimer(0);
+
+		PlugView **v = &views;
+		while (*v != this)
+			v = &(*v)->next;
+		*v = next;
+
 		PGUIVIEW_FREE(pgui_view);
 		pgui_view_created = 0;
 		return kResultTrue;
@@ -113,15 +168,69 @@ public:
 		return kResultTrue;
 	}
 
+	void onTimer() {
+		// Also catches events already read from the connection while drawing
+		PGUI_PROCESS_EVENTS(pgui);
+		controller->pollMeter();
+		if (PGUIVIEW_NEEDS_REDRAW(pgui_view)) {
+			PGUIVIEW_ON_TIMEOUT(pgui_view);
+			setTimer(REDRAW_PERIOD_MS);
+		} else if (fd != -1)
+			setTimer(controller->meter ? METER_IDLE_PERIOD_MS : 0);
+	}
+
+	void onEvents() {
+		PGUI_PROCESS_EVENTS(pgui);
+		// Views share the connection, events might have been for any of them
+		wake(pgui);
+	}
+
+	// Starts the timer of the views of pgui that have something to redraw
+	static void wake(PGUI_TYPE pgui) {
+		for (PlugView *v = views; v; v = v->next)
+			if (v->pgui == pgui && PGUIVIEW_NEEDS_REDRAW(v->pgui_view))
+				v->startTimer();
+	}
+
 private:
+	void startTimer() {
+		setTimer(REDRAW_PERIOD_MS);
+	}
+
+	void setTimer(uint32_t period) {	// 0 = stopped
+		if (period == timerPeriod)
+			return;
+		if (timerPeriod)
+			runLoop->unregisterTimer(&timer);
+		if (period)
+			runLoop->registerTimer(&timer, period);
+		timerPeriod = period;
+	}
+
+	static PlugView *views;	// attached ones, only touched from the UI thread
+
+	Controller *controller;
 	PGUI_TYPE pgui;
 	char pgui_view_created;
 	PGUIVIEW_TYPE pgui_view;
 	Linux::IRunLoop* runLoop;
 	int fd;
 	LinuxTimerHandler timer;
+	LinuxEventHandler eventHandler;
+	uint32_t timerPeriod;
+	PlugView *next;
 };
 
+PlugView *PlugView::views = nullptr;
+
+void PLUGIN_API LinuxTimerHandler::onTimer() {
+	view->onTimer();
+}
+
+void PLUGIN_API LinuxEventHandler::onFDIsSet(Linux::FileDescriptor fd) {
+	view->onEvents();
+}
+
 static float getParameterCb(PGUI_TYPE gui, uint32_t id) {
 	EditController *c = (EditController *)PGUI_GET_DATA(gui);
 	Parameter *p = c->getParameterObject(id);
@@ -182,12 +291,20 @@ tresult PLUGIN_API Controller::setComponentState(IBStream *state) {
 
 	IBStreamer streamer(state, kLittleEndian);
 
+	// as in Plugin::setState()
 	float f;
+	int n = 0;
 	for (int i = 0; i < NUM_PARAMETERS; i++) {
 		if (config_parameters[i].out)
 			continue;
-		if (streamer.readFloat(f) == false)
-			return kResultFalse;
+		if (streamer.readFloat(f) == false) {
+			if (n == 0)
+				return kResultFalse;
+			f = config_parameters[i].defaultValueUnmapped;
+		} else {
+			f = stateSanitize(f, config_parameters[i].defaultValueUnmapped);
+			n++;
+		}
 		setParamNormalized(i, f);
 	}
 
@@ -196,7 +313,63 @@ tresult PLUGIN_API Controller::setComponentState(IBStream *state) {
 
 tresult PLUGIN_API Controller::setParamNormalized(ParamID id, ParamValue value) {
 	tresult r = EditController::setParamNormalized(id, value);
-	if (r == kResultTrue)
-		PGUI_ON_PARAM_SET(pgui, id, value);
+	// Only the first value since the last frame needs to start the timers
+	if (r == kResultTrue && PGUI_ON_PARAM_SET(pgui, id, value))
+		PlugView::wake(pgui);
 	return r;
 }
+
+tresult PLUGIN_API Controller::connect(IConnectionPoint *other) {
+	tresult r = EditController::connect(other);
+	if (r != kResultTrue)
+		return r;
+
+	// In case the processor connected first and its announcement got lost
+	IPtr<IMessage> message = owned(allocateMessage());
+	if (message) {
+		message->setMessageID(METER_REQUEST_MSG_ID);
+		sendMessage(message);
+	}
+	return kResultTrue;
+}
+
+tresult PLUGIN_API Controller::disconnect(IConnectionPoint *other) {
+	meter = nullptr;
+	return EditController::disconnect(other);
+}
+
+tresult PLUGIN_API Controller::notify(IMessage *message) {
+	if (!message)
+		return kInvalidArgument;
+	if (!strcmp(message->getMessageID(), LATENCY_CHANGED_MSG_ID)) {
+		if (componentHandler)
+			componentHandler->restartComponent(kLatencyChanged);
+		return kResultOk;
+	}
+	if (strcmp(message->getMessageID(), METER_MSG_ID))
+		return EditController::notify(message);
+
+	// Otherwise values keep coming as output parameter changes through the host
+	IAttributeList *a = message->getAttributes();
+	int64 m, process, module;
+	if (!a || a->getInt("meter", m) != kResultTrue || a->getInt("process", process) != kResultTrue
+	    || a->getInt("module", module) != kResultTrue || process != meterProcessId() || module != meterModuleId())
+		return kResultOk;
+
+	IPtr<IMessage> reply = owned(allocateMessage());
+	if (!reply)
+		return kResultOk;
+	reply->setMessageID(METER_CONNECTED_MSG_ID);
+	if (sendMessage(reply) == kResultTrue)
+		meter = (Meter *)(intptr_t)m;
+	return kResultOk;
+}
+
+void Controller::pollMeter() {
+	if (!meter)
+		return;
+	uint32_t id;
+	float value;
+	while (meter->pop(id, value))
+		setParamNormalized(id, value);
+}
@@ -18,8 +18,10 @@
  */
 
 #include "controller.h"
+#include "state.h"
 
 #include "pluginterfaces/base/conststringtable.h"
+#include "pluginterfaces/vst/ivstmessage.h"
 #include "base/source/fstreamer.h"
 
 #include <sys/types.h>
@@ -29,14 +31,12 @@
 
 #include <stdio.h>
 
-static void timerProc(void* data) {
-	PGUIVIEW_TYPE pgui_view = (PGUIVIEW_TYPE)data;
-	PGUIVIEW_ON_TIMEOUT(pgui_view);
-}
+static void timerProc(void* data);
 
 class PlugView : public EditorView {
 public:
-	PlugView(EditController *controller, PGUI_TYPE pgui) : EditorView(controller, nullptr) {
+	PlugView(Controller *controller, PGUI_TYPE pgui) : EditorView(controller, nullptr) {
+		this->controller = controller;
 		this->pgui = pgui;
 		pgui_view_created = 0;
 	}
@@ -52,7 +52,7 @@ public:
 		pgui_view = PGUIVIEW_NEW(pgui, parent);
 		pgui_view_created = 1;
 		
-		timer = COSXSet_timer(20, (void*) timerProc, (void*) pgui_view);
+		timer = COSXSet_timer(20, (void*) timerProc, (void*) this);
 
 		return kResultTrue;
 	}
@@ -90,13 +90,23 @@ public:
 		return kResultTrue;
 	}
 
+	void onTimer() {
+		controller->pollMeter();
+		PGUIVIEW_ON_TIMEOUT(pgui_view);
+	}
+
 private:
+	Controller *controller;
 	PGUI_TYPE pgui;
 	char pgui_view_created;
 	PGUIVIEW_TYPE pgui_view;
 	void* timer;
 };
 
+static void timerProc(void* data) {
+	((PlugView *)data)->onTimer();
+}
+
 static float getParameterCb(PGUI_TYPE gui, uint32_t id) {
 	EditController *c = (EditController *)PGUI_GET_DATA(gui);
 	Parameter *p = c->getParameterObject(id);
@@ -157,10 +167,20 @@ tresult PLUGIN_API Controller::setComponentState(IBStream *state) {
 
 	IBStreamer streamer(state, kLittleEndian);
 
+	// as in Plugin::setState()
 	float f;
+	int n = 0;
 	for (int i = 0; i < NUM_PARAMETERS; i++) {
-		if (streamer.readFloat(f) == false)
-			return kResultFalse;
+		if (config_parameters[i].out)
+			continue;
+		if (streamer.readFloat(f) == false) {
+			if (n == 0)
+				return kResultFalse;
+			f = config_parameters[i].defaultValueUnmapped;
+		} else {
+			f = stateSanitize(f, config_parameters[i].defaultValueUnmapped);
+			n++;
+		}
 		setParamNormalized(i, f);
 	}
 
@@ -173,3 +193,58 @@ tresult PLUGIN_API Controller::setParamNormalized(ParamID id, ParamValue value)
 		PGUI_ON_PARAM_SET(pgui, id, value);
 	return r;
 }
+
+tresult PLUGIN_API Controller::connect(IConnectionPoint *other) {
+	tresult r = EditController::connect(other);
+	if (r != kResultTrue)
+		return r;
+
+	// In case the processor connected first and its announcement got lost
+	IPtr<IMessage> message = owned(allocateMessage());
+	if (message) {
+		message->setMessageID(METER_REQUEST_MSG_ID);
+		sendMessage(message);
+	}
+	return kResultTrue;
+}
+
+tresult PLUGIN_API Controller::disconnect(IConnectionPoint *other) {
+	meter = nullptr;
+	return EditController::disconnect(other);
+}
+
+tresult PLUGIN_API Controller::notify(IMessage *message) {
+	if (!message)
+		return kInvalidArgument;
+	if (!strcmp(message->getMessageID(), LATENCY_CHANGED_MSG_ID)) {
+		if (componentHandler)
+			componentHandler->restartComponent(kLatencyChanged);
+		return kResultOk;
+	}
+	if (strcmp(message->getMessageID(), METER_MSG_ID))
+		return EditController::notify(message);
+
+	// Otherwise values keep coming as output parameter changes through the host
+	IAttributeList *a = message->getAttributes();
+	int64 m, process, module;
+	if (!a || a->getInt("meter", m) != kResultTrue || a->getInt("process", process) != kResultTrue
+	    || a->getInt("module", module) != kResultTrue || process != meterProcessId() || module != meterModuleId())
+		return kResultOk;
+
+	IPtr<IMessage> reply = owned(allocateMessage());
+	if (!reply)
+		return kResultOk;
+	reply->setMessageID(METER_CONNECTED_MSG_ID);
+	if (sendMessage(reply) == kResultTrue)
+		meter = (Meter *)(intptr_t)m;
+	return kResultOk;
+}
+
+void Controller::pollMeter() {
+	if (!meter)
+		return;
+	uint32_t id;
+	float value;
+	while (meter->pop(id, value))
+		setParamNormalized(id, value);
+}
@@ -0,0 +1,92 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#ifndef _VST3_METER_H
+#define _VST3_METER_H
+
+// Output parameter values from the processor to the editor, bypassing the
+// host. The processor owns a Meter and announces it with a METER_MSG_ID
+// message on connect(), and again when the controller asks with
+// METER_REQUEST_MSG_ID on its own connect(), as messages sent before the
+// sender is connected get lost and hosts connect the two in either order. The
+// controller only uses it if it is in the same process and module, and
+// answers with METER_CONNECTED_MSG_ID, after which the processor stops sending
+// the values as output parameter changes.
+
+#include <atomic>
+#include <stdint.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <sys/types.h>
+# include <unistd.h>
+#endif
+
+#define METER_MSG_ID		"Meter"
+#define METER_REQUEST_MSG_ID	"MeterRequest"
+#define METER_CONNECTED_MSG_ID	"MeterConnected"
+#define METER_RATE		60	// Hz, at most
+#define METER_SIZE		32	// parameter ids, at most
+
+// Latest value per parameter, single producer (audio thread), single consumer
+// (UI thread). Values are only ever superseded, never dropped, however long
+// the consumer doesn't poll (e.g., while no editor is open). A value may be
+// popped twice if pushed while being popped.
+struct Meter {
+	std::atomic<uint32_t> dirty;	// bit per parameter id
+	std::atomic<float> value[METER_SIZE];
+
+	Meter() : dirty(0) {
+		for (int i = 0; i < METER_SIZE; i++)
+			value[i].store(0.f, std::memory_order_relaxed);
+	}
+
+	void push(uint32_t id, float value) {
+		this->value[id].store(value, std::memory_order_relaxed);
+		dirty.fetch_or(1u << id, std::memory_order_release);
+	}
+
+	bool pop(uint32_t &id, float &value) {
+		const uint32_t d = dirty.load(std::memory_order_relaxed);
+		if (d == 0)
+			return false;
+		for (id = 0; !(d & (1u << id)); id++)
+			;
+		dirty.fetch_and(~(1u << id), std::memory_order_acquire);
+		value = this->value[id].load(std::memory_order_relaxed);
+		return true;
+	}
+};
+
+static inline int64_t meterProcessId() {
+#ifdef _WIN32
+	return (int64_t)GetCurrentProcessId();
+#else
+	return (int64_t)getpid();
+#endif
+}
+
+// Same address in all translation units of this module
+inline int64_t meterModuleId() {
+	static char c;
+	return (int64_t)(intptr_t)&c;
+}
+
+#endif
@@ -41,12 +41,15 @@
  */
 
 #include "plugin.h"
+#include "state.h"
 
 #include "pluginterfaces/base/conststringtable.h"
 #include "pluginterfaces/vst/ivstparameterchanges.h"
+#include "pluginterfaces/vst/ivstmessage.h"
 #include "base/source/fstreamer.h"
 
 #include <algorithm>
+#include <cstring>
 
 #if defined(__aarch64__)
 
@@ -143,7 +146,9 @@ static inline void _sse2neon_mm_set_flush_zero_mode(unsigned int flag)
 
 #endif
 
-Plugin::Plugin() {
+static_assert(NUM_PARAMETERS <= METER_SIZE, "parameter ids must fit in the meter");
+
+Plugin::Plugin() : meterConnected(false), meterPeriod(1), meterCountdown(0) {
 	setControllerClass(FUID(CTRL_GUID_1, CTRL_GUID_2, CTRL_GUID_3, CTRL_GUID_4));
 }
 
@@ -204,15 +209,42 @@ tresult PLUGIN_API Plugin::setActive(TBool state) {
 	if (state) {
 		P_SET_SAMPLE_RATE(instance, sampleRate);
 		P_RESET(instance);
+		meterPeriod = std::max(static_cast<int32>(sampleRate * (1.f / METER_RATE)), static_cast<int32>(1));
+		meterCountdown = 0;
+#ifdef P_GET_LATENCY
+		// The controller has the host query it again
+		if (static_cast<uint32>(P_GET_LATENCY(instance)) != latency) {
+			IPtr<IMessage> message = owned(allocateMessage());
+			if (message) {
+				message->setMessageID(LATENCY_CHANGED_MSG_ID);
+				sendMessage(message);
+			}
+		}
+#endif
 	}
 	return AudioEffect::setActive(state);
 }
 
 tresult PLUGIN_API Plugin::setupProcessing(ProcessSetup &setup) {
 	sampleRate = static_cast<float>(setup.sampleRate);
+#ifdef P_SET_QUALITY
+	P_SET_QUALITY(instance, setup.processMode == kOffline ? P_QUALITY_OFFLINE : P_QUALITY_REALTIME);
+#endif
+#ifdef P_SET_DECIMATION
+	// Offline renders get the full rate filters, and no latency
+	P_SET_DECIMATION(instance, setup.processMode != kOffline);
+#endif
 	return AudioEffect::setupProcessing(setup);
 }
 
+#ifdef P_GET_LATENCY
+// Depends on the sample rate, which is only set in setActive()
+uint32 PLUGIN_API Plugin::getLatencySamples() {
+	latency = static_cast<uint32>(P_GET_LATENCY(instance));
+	return latency;
+}
+#endif
+
 tresult PLUGIN_API Plugin::process(ProcessData &data) {
 	if (data.inputParameterChanges) {
 		int32 n = data.inputParameterChanges->getParameterCount();
@@ -223,7 +255,10 @@ tresult PLUGIN_API Plugin::process(ProcessData &data) {
 			ParamValue v;
 			int32 o;
 			if (q->getPoint(q->getPointCount() - 1, o, v) == kResultTrue) {
-				int32 pi = q->getParameterId();
+				ParamID pi = q->getParameterId();
+				// from the host, skip unknown (ParamID is unsigned) and output ids
+				if (pi >= NUM_PARAMETERS || config_parameters[pi].out)
+					continue;
 				parameters[pi] = v;
 				P_SET_PARAMETER(instance, pi, std::min(std::max(static_cast<float>(v), 0.f), 1.f));
 			}
@@ -262,6 +297,23 @@ tresult PLUGIN_API Plugin::process(ProcessData &data) {
 	_MM_SET_DENORMALS_ZERO_MODE(denormals_zero_mode);
 #endif
 
+	if (meterConnected.load(std::memory_order_relaxed)) {
+		meterCountdown -= data.numSamples;
+		if (meterCountdown > 0)
+			return kResultTrue;
+		meterCountdown = meterCountdown + meterPeriod > 0 ? meterCountdown + meterPeriod : meterPeriod;
+		for (int i = 0; i < NUM_PARAMETERS; i++) {
+			if (!config_parameters[i].out)
+				continue;
+			float v = P_GET_PARAMETER(instance, i);
+			if (parameters[i] == v)
+				continue;
+			parameters[i] = v;
+			meter.push(i, v);
+		}
+		return kResultTrue;
+	}
+
 	for (int i = 0; i < NUM_PARAMETERS; i++) {
 		if (!config_parameters[i].out)
 			continue;
@@ -280,6 +332,44 @@ tresult PLUGIN_API Plugin::process(ProcessData &data) {
 	return kResultTrue;
 }
 
+void Plugin::announceMeter() {
+	IPtr<IMessage> message = owned(allocateMessage());
+	if (!message)
+		return;
+	message->setMessageID(METER_MSG_ID);
+	message->getAttributes()->setInt("meter", (int64)(intptr_t)&meter);
+	message->getAttributes()->setInt("process", meterProcessId());
+	message->getAttributes()->setInt("module", meterModuleId());
+	sendMessage(message);
+}
+
+tresult PLUGIN_API Plugin::connect(IConnectionPoint *other) {
+	tresult r = AudioEffect::connect(other);
+	if (r != kResultTrue)
+		return r;
+	announceMeter();	// lost if the controller is not connected yet, then it asks
+	return kResultTrue;
+}
+
+tresult PLUGIN_API Plugin::disconnect(IConnectionPoint *other) {
+	meterConnected.store(false, std::memory_order_relaxed);
+	return AudioEffect::disconnect(other);
+}
+
+tresult PLUGIN_API Plugin::notify(IMessage *message) {
+	if (!message)
+		return kInvalidArgument;
+	if (!strcmp(message->getMessageID(), METER_CONNECTED_MSG_ID)) {
+		meterConnected.store(true, std::memory_order_relaxed);
+		return kResultOk;
+	}
+	if (!strcmp(message->getMessageID(), METER_REQUEST_MSG_ID)) {
+		announceMeter();
+		return kResultOk;
+	}
+	return AudioEffect::notify(message);
+}
+
 tresult PLUGIN_API Plugin::setBusArrangements(SpeakerArrangement *inputs, int32 numIns, SpeakerArrangement *outputs, int32 numOuts) {
 	if (numIns < minBusesIn || numIns > NUM_BUSES_IN)
 		return kResultFalse;
@@ -304,12 +394,21 @@ tresult PLUGIN_API Plugin::setState(IBStream *state) {
 
 	IBStreamer streamer(state, kLittleEndian);
 
+	// States from older versions have fewer parameters, the others get their
+	// default values
 	float f;
+	int n = 0;
 	for (int i = 0; i < NUM_PARAMETERS; i++) {
 		if (config_parameters[i].out)
 			continue;
-		if (streamer.readFloat(f) == false)
-			return kResultFalse;
+		if (streamer.readFloat(f) == false) {
+			if (n == 0)
+				return kResultFalse;
+			f = config_parameters[i].defaultValueUnmapped;
+		} else {
+			f = stateSanitize(f, config_parameters[i].defaultValueUnmapped);
+			n++;
+		}
 		parameters[i] = f;
 		P_SET_PARAMETER(instance, i, f);
 	}
@@ -21,6 +21,7 @@
 #define _VST3_PLUGIN_H
 
 #include "config.h"
+#include "meter.h"
 
 #include "public.sdk/source/vst/vstaudioeffect.h"
 
@@ -43,6 +44,12 @@ public:
 	tresult PLUGIN_API setBusArrangements(SpeakerArrangement *inputs, int32 numIns, SpeakerArrangement *outputs, int32 numOuts) SMTG_OVERRIDE;
 	tresult PLUGIN_API setState(IBStream *state) SMTG_OVERRIDE;
 	tresult PLUGIN_API getState(IBStream *state) SMTG_OVERRIDE;
+	tresult PLUGIN_API connect(IConnectionPoint *other) SMTG_OVERRIDE;
+	tresult PLUGIN_API disconnect(IConnectionPoint *other) SMTG_OVERRIDE;
+	tresult PLUGIN_API notify(IMessage *message) SMTG_OVERRIDE;
+#ifdef P_GET_LATENCY
+	uint32 PLUGIN_API getLatencySamples() SMTG_OVERRIDE;
+#endif
 
 private:
 	float sampleRate;
@@ -53,6 +60,17 @@ private:
 	P_TYPE instance;
 	const float *inputs[NUM_CHANNELS_IN];
 	float *outputs[NUM_CHANNELS_OUT];
+
+	void announceMeter();
+
+	Meter meter;
+	std::atomic<bool> meterConnected;
+	int32 meterPeriod;	// samples
+	int32 meterCountdown;
+
+#ifdef P_GET_LATENCY
+	uint32 latency = 0;	// last reported to the host
+#endif
 };
 
 #endif
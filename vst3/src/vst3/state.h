@@ -0,0 +1,40 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+#ifndef _VST3_STATE_H
+#define _VST3_STATE_H
+
+// Parameter values read from states, shared by Plugin::setState() and
+// Controller::setComponentState() so that both sides end up with the same
+// values, and by tools/fuzz.c, hence plain C
+
+#include <stdint.h>
+#include <string.h>
+
+// States are not trusted: anything but a finite value gets the default (the
+// check works with -ffast-math), others are clipped to [0, 1]
+static inline float stateSanitize(float f, float def) {
+	uint32_t u;
+	memcpy(&u, &f, sizeof(u));
+	if ((u & 0x7f800000) == 0x7f800000)
+		return def;
+	return f < 0.f ? 0.f : (f > 1.f ? 1.f : f);
+}
+
+#endif
@@ -0,0 +1,373 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Headless editor benchmark: runs asid_gui on the offscreen backend through
+// a few scenarios (opening editors, resize storm, slider drag, modulated
+// cutoff sweep), one frame being what a host timer tick does, and reports
+// CPU time per frame, bytes drawn to the windows and memory. With -o it also
+// writes the first editor as a PNG after each scenario, for visual diffing.
+
+#include "asid_gui.h"
+#include "gui-offscreen.h"
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_EDITORS	256
+
+typedef struct {
+	asid_gui	 gui;
+	asid_gui_view	 view;
+	window		 win;
+	float		 params[4];
+} editor;
+
+typedef struct {
+	const char	*name;
+	uint32_t	 frames;
+	double		 cpu;
+	double		 cpu_max;
+	uint64_t	 bytes;
+	uint32_t	 draws;
+} stats;
+
+static editor editors[MAX_EDITORS];
+static int n_editors = 1;
+static const char *png_prefix = NULL;
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static size_t heap_bytes() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+	struct mallinfo2 mi = mallinfo2();
+#else
+	struct mallinfo mi = mallinfo();
+#endif
+	return (size_t)mi.uordblks + (size_t)mi.hblkhd;	// big buffers are mmap()ed
+}
+
+static float get_parameter(asid_gui gui, uint32_t id) {
+	return ((editor *)asid_gui_get_data(gui))->params[id];
+}
+
+// As if the host echoed the edit right away
+static void set_parameter(asid_gui gui, uint32_t id, float value) {
+	((editor *)asid_gui_get_data(gui))->params[id] = value;
+	asid_gui_on_param_set(gui, id, value);
+}
+
+// Minimal PNG: RGB, stored (uncompressed) deflate blocks
+
+static uint32_t crc_table[256];
+
+static uint32_t crc(uint32_t c, const unsigned char *data, size_t n) {
+	if (crc_table[1] == 0)
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t k = i;
+			for (int j = 0; j < 8; j++)
+				k = k & 1 ? 0xedb88320 ^ (k >> 1) : k >> 1;
+			crc_table[i] = k;
+		}
+	c = ~c;
+	for (size_t i = 0; i < n; i++)
+		c = crc_table[(c ^ data[i]) & 0xff] ^ (c >> 8);
+	return ~c;
+}
+
+static void put32(unsigned char *p, uint32_t v) {
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+static void write_chunk(FILE *f, const char *type, const unsigned char *data, uint32_t n) {
+	unsigned char b[4];
+	put32(b, n);
+	fwrite(b, 1, 4, f);
+	fwrite(type, 1, 4, f);
+	fwrite(data, 1, n, f);
+	put32(b, crc(crc(0, (const unsigned char *)type, 4), data, n));
+	fwrite(b, 1, 4, f);
+}
+
+static void write_png(const char *path, window w) {
+	const uint32_t width = asid_gui_view_get_width(editors[0].view);
+	const uint32_t height = asid_gui_view_get_height(editors[0].view);
+	const unsigned char *pixels = gui_offscreen_get_pixels(w);
+
+	const size_t raw_n = (size_t)(width * 3 + 1) * height;
+	unsigned char *raw = (unsigned char *)malloc(raw_n);
+	const size_t blocks = (raw_n + 65534) / 65535;
+	const size_t z_n = 2 + raw_n + 5 * blocks + 4;
+	unsigned char *z = (unsigned char *)malloc(z_n);
+	FILE *f = fopen(path, "wb");
+	if (raw == NULL || z == NULL || f == NULL) {
+		fprintf(stderr, "%s: can't write\n", path);
+		free(raw);
+		free(z);
+		if (f)
+			fclose(f);
+		return;
+	}
+
+	unsigned char *r = raw;
+	for (uint32_t y = 0; y < height; y++) {
+		*r++ = 0;
+		for (uint32_t x = 0; x < width; x++, pixels += 4) {
+			*r++ = pixels[2];
+			*r++ = pixels[1];
+			*r++ = pixels[0];
+		}
+	}
+
+	unsigned char *d = z;
+	*d++ = 0x78;
+	*d++ = 0x01;
+	uint32_t a = 1, b = 0;
+	for (size_t i = 0; i < raw_n; i += 65535) {
+		const uint32_t n = raw_n - i < 65535 ? raw_n - i : 65535;
+		*d++ = i + n == raw_n;
+		*d++ = n;
+		*d++ = n >> 8;
+		*d++ = ~n;
+		*d++ = ~n >> 8;
+		memcpy(d, raw + i, n);
+		d += n;
+		for (uint32_t j = 0; j < n; j++) {
+			a = (a + raw[i + j]) % 65521;
+			b = (b + a) % 65521;
+		}
+	}
+	put32(d, (b << 16) | a);
+
+	unsigned char ihdr[13];
+	put32(ihdr, width);
+	put32(ihdr + 4, height);
+	ihdr[8] = 8;	// bit depth
+	ihdr[9] = 2;	// RGB
+	ihdr[10] = ihdr[11] = ihdr[12] = 0;
+	fwrite("\x89PNG\r\n\x1a\n", 1, 8, f);
+	write_chunk(f, "IHDR", ihdr, 13);
+	write_chunk(f, "IDAT", z, z_n);
+	write_chunk(f, "IEND", (const unsigned char *)"", 0);
+	fclose(f);
+	free(raw);
+	free(z);
+}
+
+// Frames
+
+static void begin(stats *s, const char *name) {
+	s->name = name;
+	s->frames = 0;
+	s->cpu = 0.0;
+	s->cpu_max = 0.0;
+	s->bytes = 0;
+	s->draws = 0;
+	for (int i = 0; i < n_editors; i++)
+		if (editors[i].win) {	// not yet for "open"
+			s->bytes -= gui_offscreen_get_bytes_drawn(editors[i].win);
+			s->draws -= gui_offscreen_get_draws(editors[i].win);
+		}
+}
+
+// What a host timer tick does for every editor, after the scenario's input
+static void tick(stats *s, double start) {
+	for (int i = 0; i < n_editors; i++) {
+		asid_gui_process_events(editors[i].gui);
+		asid_gui_view_on_timeout(editors[i].view);
+	}
+	const double t = now() - start;
+	s->cpu += t;
+	if (t > s->cpu_max)
+		s->cpu_max = t;
+	s->frames++;
+}
+
+static void end(stats *s) {
+	for (int i = 0; i < n_editors; i++) {
+		s->bytes += gui_offscreen_get_bytes_drawn(editors[i].win);
+		s->draws += gui_offscreen_get_draws(editors[i].win);
+	}
+	printf("%-10s %7u frames %9.3f ms/frame %9.3f ms worst %10.1f KiB/frame %6.2f draws/frame\n",
+	       s->name, s->frames, 1e3 * s->cpu / s->frames, 1e3 * s->cpu_max,
+	       (double)s->bytes / s->frames / 1024.0, (double)s->draws / s->frames);
+	if (png_prefix) {
+		char path[1024];
+		snprintf(path, sizeof(path), "%s-%s.png", png_prefix, s->name);
+		write_png(path, editors[0].win);
+	}
+}
+
+// Until bilinear scaling after the last size change, and then one more
+static void settle(stats *s) {
+	for (int i = 0; i < 8; i++)
+		tick(s, now());
+}
+
+static void usage(const char *argv0) {
+	fprintf(stderr, "Usage: %s [-e editors] [-f frames] [-s scale] [-u updates per frame] [-o png prefix]\n", argv0);
+}
+
+int main(int argc, char **argv) {
+	int frames = 500;
+	float scale = 2.5f;
+	int updates = 15;	// e.g., once per 64 samples at 48 kHz and 50 frames/s
+
+	int opt;
+	while ((opt = getopt(argc, argv, "e:f:s:u:o:")) != -1) {
+		switch (opt) {
+		case 'e':
+			n_editors = atoi(optarg);
+			break;
+		case 'f':
+			frames = atoi(optarg);
+			break;
+		case 's':
+			scale = atof(optarg);
+			break;
+		case 'u':
+			updates = atoi(optarg);
+			break;
+		case 'o':
+			png_prefix = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if (optind != argc || n_editors < 1 || n_editors > MAX_EDITORS || frames < 1 || scale < 0.5f || updates < 1) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	// Window sizes keep the default aspect ratio, so that content
+	// coordinates are just the defaults times the scale
+	const uint32_t w0 = asid_gui_get_default_width(NULL);
+	const uint32_t h0 = asid_gui_get_default_height(NULL);
+	const uint32_t width = (uint32_t)(w0 * scale);
+	const uint32_t height = (uint32_t)(h0 * scale);
+	stats s;
+
+	// Opening editors, one instance each (same as separate plugin instances)
+	const size_t heap_before = heap_bytes();
+	begin(&s, "open");
+	for (int i = 0; i < n_editors; i++) {
+		const double start = now();
+		editor *e = editors + i;
+		e->params[0] = 0.5f;
+		e->params[1] = 0.f;
+		e->params[2] = 0.5f;
+		e->params[3] = 0.f;
+		e->gui = asid_gui_new(get_parameter, set_parameter, e);
+		e->view = e->gui ? asid_gui_view_new(e->gui, NULL) : NULL;
+		if (e->view == NULL) {
+			fprintf(stderr, "can't create editor %d\n", i);
+			return 1;
+		}
+		e->win = (window)asid_gui_view_get_handle(e->view);
+		asid_gui_view_resize_window(e->view, width, height);
+		asid_gui_process_events(e->gui);
+		asid_gui_view_on_timeout(e->view);
+		const double t = now() - start;
+		s.cpu += t;
+		if (t > s.cpu_max)
+			s.cpu_max = t;
+		s.frames++;
+	}
+	settle(&s);
+	end(&s);
+	const size_t heap_after = heap_bytes();
+
+	// Resize storm: a new size every frame, as when dragging a corner
+	begin(&s, "resize");
+	for (int f = 0; f < frames; f++) {
+		const double start = now();
+		const float k = 1.f + 3.f * (f % 100) / 99.f;
+		for (int i = 0; i < n_editors; i++)
+			asid_gui_view_resize_window(editors[i].view, (uint32_t)(w0 * k), (uint32_t)(h0 * k));
+		tick(&s, start);
+	}
+	for (int i = 0; i < n_editors; i++)
+		asid_gui_view_resize_window(editors[i].view, width, height);
+	settle(&s);
+	end(&s);
+
+	// Dragging the cutoff slider up and down
+	const int32_t x = (int32_t)(scale * (42 + 28));
+	const int32_t y = (int32_t)(scale * (42 + 110));
+	begin(&s, "drag");
+	for (int i = 0; i < n_editors; i++) {
+		gui_offscreen_mouse_move(editors[i].win, x, y, 0);
+		gui_offscreen_mouse_press(editors[i].win, x, y);
+	}
+	for (int f = 0; f < frames; f++) {
+		const double start = now();
+		const int32_t dy = (int32_t)(scale * (f % 200 < 100 ? f % 100 : 100 - f % 100));
+		for (int i = 0; i < n_editors; i++)
+			gui_offscreen_mouse_move(editors[i].win, x, y - dy, 1);
+		tick(&s, start);
+	}
+	for (int i = 0; i < n_editors; i++) {
+		gui_offscreen_mouse_release(editors[i].win, x, y);
+		gui_offscreen_mouse_move(editors[i].win, 0, 0, 0);
+	}
+	settle(&s);
+	end(&s);
+
+	// Modulated cutoff sweeping through all screens, like a fast LFO, with
+	// as many updates per frame as the host sends
+	begin(&s, "modcutoff");
+	for (int f = 0; f < frames; f++) {
+		const double start = now();
+		for (int u = 0; u < updates; u++) {
+			const float v = (f % 50 + (float)u / updates) / 50.f;
+			for (int i = 0; i < n_editors; i++)
+				asid_gui_on_param_set(editors[i].gui, 3, f % 100 < 50 ? v : 1.f - v);
+		}
+		tick(&s, start);
+	}
+	settle(&s);
+	end(&s);
+
+	struct rusage ru;
+	getrusage(RUSAGE_SELF, &ru);
+	printf("editors:           %d at %ux%u\n", n_editors, width, height);
+	printf("heap per editor:   %.1f KiB (after opening)\n", (double)(heap_after - heap_before) / n_editors / 1024.0);
+	printf("heap at the end:   %.1f KiB\n", (double)heap_bytes() / 1024.0);
+	printf("peak RSS:          %.1f KiB\n", (double)ru.ru_maxrss);
+
+	for (int i = 0; i < n_editors; i++) {
+		asid_gui_view_free(editors[i].view);
+		asid_gui_free(editors[i].gui);
+	}
+
+	return 0;
+}
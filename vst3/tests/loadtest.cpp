@@ -0,0 +1,354 @@
+/*
+ * A-SID - C64 bandpass filter + LFO
+ *
+ * Copyright (C) 2022 Orastron srl unipersonale
+ *
+ * A-SID is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3 of the License.
+ *
+ * A-SID is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ *
+ * File author: Stefano D'Angelo
+ */
+
+// Headless load test: loads the bundle, runs N instances back to back as a
+// host would in one audio callback and reports CPU time, blocks that took
+// longer than their duration and memory per instance. Linux only.
+
+#include "pluginterfaces/base/ipluginbase.h"
+#include "pluginterfaces/vst/ivstcomponent.h"
+#include "pluginterfaces/vst/ivstaudioprocessor.h"
+#include "pluginterfaces/vst/ivstparameterchanges.h"
+#include "pluginterfaces/vst/ivstprocesscontext.h"
+
+#include "vst3/config.h"
+
+#include <dlfcn.h>
+#include <malloc.h>
+#include <time.h>
+#include <unistd.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+typedef IPluginFactory *(PLUGIN_API *GetFactoryProc)();
+typedef bool (*ModuleEntryProc)(void *);
+typedef bool (*ModuleExitProc)();
+
+// Just enough of IParamValueQueue/IParameterChanges for one point per
+// parameter per block, no allocations while processing
+
+class ParamQueue : public IParamValueQueue {
+public:
+	ParamID id;
+	int32 offset;
+	ParamValue value;
+
+	tresult PLUGIN_API queryInterface(const TUID, void **obj) SMTG_OVERRIDE { *obj = nullptr; return kNoInterface; }
+	uint32 PLUGIN_API addRef() SMTG_OVERRIDE { return 1; }
+	uint32 PLUGIN_API release() SMTG_OVERRIDE { return 1; }
+
+	ParamID PLUGIN_API getParameterId() SMTG_OVERRIDE { return id; }
+	int32 PLUGIN_API getPointCount() SMTG_OVERRIDE { return 1; }
+	tresult PLUGIN_API getPoint(int32 index, int32 &sampleOffset, ParamValue &v) SMTG_OVERRIDE {
+		if (index != 0)
+			return kResultFalse;
+		sampleOffset = offset;
+		v = value;
+		return kResultTrue;
+	}
+	tresult PLUGIN_API addPoint(int32 sampleOffset, ParamValue v, int32 &index) SMTG_OVERRIDE {
+		offset = sampleOffset;
+		value = v;
+		index = 0;
+		return kResultTrue;
+	}
+};
+
+class ParamChanges : public IParameterChanges {
+public:
+	ParamQueue queues[NUM_PARAMETERS];
+	int32 count;
+
+	ParamChanges() : count(0) {}
+
+	tresult PLUGIN_API queryInterface(const TUID, void **obj) SMTG_OVERRIDE { *obj = nullptr; return kNoInterface; }
+	uint32 PLUGIN_API addRef() SMTG_OVERRIDE { return 1; }
+	uint32 PLUGIN_API release() SMTG_OVERRIDE { return 1; }
+
+	int32 PLUGIN_API getParameterCount() SMTG_OVERRIDE { return count; }
+	IParamValueQueue *PLUGIN_API getParameterData(int32 index) SMTG_OVERRIDE {
+		return index >= 0 && index < count ? queues + index : nullptr;
+	}
+	IParamValueQueue *PLUGIN_API addParameterData(const ParamID &id, int32 &index) SMTG_OVERRIDE {
+		for (index = 0; index < count; index++)
+			if (queues[index].id == id)
+				return queues + index;
+		if (count == NUM_PARAMETERS)
+			return nullptr;
+		queues[count].id = id;
+		return queues + count++;
+	}
+};
+
+enum pattern { pattern_noise, pattern_silence, pattern_automation };
+
+struct Instance {
+	IComponent *component;
+	IAudioProcessor *processor;
+	ParamChanges in_changes;
+	ParamChanges out_changes;
+	std::vector<float> y;
+};
+
+static double now(clockid_t clock) {
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static size_t heap_bytes() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+	return mallinfo2().uordblks;
+#else
+	return (size_t)mallinfo().uordblks;
+#endif
+}
+
+static size_t rss_bytes() {
+	FILE *f = fopen("/proc/self/statm", "r");
+	if (!f)
+		return 0;
+	unsigned long size, rss = 0;
+	if (fscanf(f, "%lu %lu", &size, &rss) != 2)
+		rss = 0;
+	fclose(f);
+	return rss * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+static void usage(const char *argv0) {
+	fprintf(stderr, "Usage: %s [-n instances] [-b block size] [-r sample rate] [-t seconds] [-p noise|silence|automation] [-o] bundle.vst3\n", argv0);
+}
+
+int main(int argc, char **argv) {
+	int n_instances = 16;
+	int block_size = 64;
+	double sample_rate = 48000.0;
+	double seconds = 10.0;
+	enum pattern pattern = pattern_noise;
+	bool offline = false;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "n:b:r:t:p:o")) != -1) {
+		switch (opt) {
+		case 'n':
+			n_instances = atoi(optarg);
+			break;
+		case 'b':
+			block_size = atoi(optarg);
+			break;
+		case 'r':
+			sample_rate = atof(optarg);
+			break;
+		case 't':
+			seconds = atof(optarg);
+			break;
+		case 'p':
+			if (!strcmp(optarg, "noise"))
+				pattern = pattern_noise;
+			else if (!strcmp(optarg, "silence"))
+				pattern = pattern_silence;
+			else if (!strcmp(optarg, "automation"))
+				pattern = pattern_automation;
+			else {
+				usage(argv[0]);
+				return 1;
+			}
+			break;
+		case 'o':
+			offline = true;
+			break;
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if (optind != argc - 1 || n_instances < 1 || block_size < 1 || sample_rate <= 0.0 || seconds <= 0.0) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	std::string bundle = argv[optind];
+	std::string name = bundle.substr(bundle.find_last_of('/') + 1);
+	name = name.substr(0, name.find_last_of('.'));
+	std::string path = bundle + "/Contents/x86_64-linux/" + name + ".so";
+
+	void *module = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if (!module) {
+		fprintf(stderr, "%s\n", dlerror());
+		return 1;
+	}
+	ModuleEntryProc moduleEntry = (ModuleEntryProc)dlsym(module, "ModuleEntry");
+	ModuleExitProc moduleExit = (ModuleExitProc)dlsym(module, "ModuleExit");
+	GetFactoryProc getFactory = (GetFactoryProc)dlsym(module, "GetPluginFactory");
+	if (!moduleEntry || !moduleExit || !getFactory) {
+		fprintf(stderr, "%s: not a VST3 module\n", path.c_str());
+		return 1;
+	}
+	if (!moduleEntry(module)) {
+		fprintf(stderr, "%s: ModuleEntry failed\n", path.c_str());
+		return 1;
+	}
+
+	IPluginFactory *factory = getFactory();
+	PClassInfo info;
+	int32 i;
+	for (i = 0; i < factory->countClasses(); i++)
+		if (factory->getClassInfo(i, &info) == kResultOk && !strcmp(info.category, kVstAudioEffectClass))
+			break;
+	if (i == factory->countClasses()) {
+		fprintf(stderr, "%s: no audio effect class\n", path.c_str());
+		return 1;
+	}
+
+	ProcessSetup setup;
+	setup.processMode = offline ? kOffline : kRealtime;
+	setup.symbolicSampleSize = kSample32;
+	setup.maxSamplesPerBlock = block_size;
+	setup.sampleRate = sample_rate;
+
+	// Memory is measured around creation and activation, i.e. everything
+	// but the host side buffers
+	std::vector<Instance> instances(n_instances);
+	for (Instance &inst : instances)
+		inst.y.resize(block_size);
+	const size_t heap_before = heap_bytes();
+	const size_t rss_before = rss_bytes();
+	for (Instance &inst : instances) {
+		if (factory->createInstance(info.cid, IComponent::iid, (void **)&inst.component) != kResultOk
+		    || inst.component->initialize(nullptr) != kResultOk
+		    || inst.component->queryInterface(IAudioProcessor::iid, (void **)&inst.processor) != kResultOk) {
+			fprintf(stderr, "%s: could not instantiate %s\n", path.c_str(), info.name);
+			return 1;
+		}
+		if (inst.processor->setupProcessing(setup) != kResultOk) {
+			fprintf(stderr, "%s: setupProcessing failed\n", path.c_str());
+			return 1;
+		}
+		inst.component->activateBus(kAudio, kInput, 0, true);
+		inst.component->activateBus(kAudio, kOutput, 0, true);
+		inst.component->setActive(true);
+		inst.processor->setProcessing(true);
+	}
+	const size_t heap_after = heap_bytes();
+	const size_t rss_after = rss_bytes();
+
+	std::vector<float> x(block_size);
+	float *x_channels[1] = { x.data() };
+	float *y_channels[1];
+	AudioBusBuffers input, output;
+	input.numChannels = 1;
+	input.channelBuffers32 = x_channels;
+	output.numChannels = 1;
+	output.channelBuffers32 = y_channels;
+
+	ProcessData data;
+	data.processMode = setup.processMode;
+	data.symbolicSampleSize = kSample32;
+	data.numSamples = block_size;
+	data.numInputs = 1;
+	data.numOutputs = 1;
+	data.inputs = &input;
+	data.outputs = &output;
+
+	const long n_blocks = (long)(seconds * sample_rate / block_size);
+	const double deadline = block_size / sample_rate;
+	double block_max = 0.0;
+	long misses = 0;
+	uint32_t seed = 1;
+	double cpu = 0.0;
+	const double wall_start = now(CLOCK_MONOTONIC);
+	for (long b = 0; b < n_blocks; b++) {
+		// Input generation is not timed
+		input.silenceFlags = pattern == pattern_silence ? 1 : 0;
+		for (int j = 0; j < block_size; j++) {
+			seed = seed * 1664525 + 1013904223;
+			x[j] = pattern == pattern_silence ? 0.f : 0.5f * ((int32_t)seed * (1.f / 2147483648.f));
+		}
+		if (pattern == pattern_automation) {
+			// A different triangle per parameter and instance, one point
+			// per parameter per block, like a host following a lane
+			for (int k = 0; k < n_instances; k++) {
+				ParamChanges &c = instances[k].in_changes;
+				c.count = 0;
+				for (int p = 0; p < NUM_PARAMETERS; p++) {
+					if (config_parameters[p].out)
+						continue;
+					const double t = 1e-3 * (b * (p + 1) + 97 * k);
+					int32 index;
+					c.addParameterData(p, index)->addPoint(0, 2.0 * fabs(t - floor(t + 0.5)), index);
+				}
+			}
+		}
+
+		const double cpu_block_start = now(CLOCK_PROCESS_CPUTIME_ID);
+		const double block_start = now(CLOCK_MONOTONIC);
+		for (Instance &inst : instances) {
+			y_channels[0] = inst.y.data();
+			inst.out_changes.count = 0;
+			data.inputParameterChanges = &inst.in_changes;
+			data.outputParameterChanges = &inst.out_changes;
+			inst.processor->process(data);
+		}
+		const double block_time = now(CLOCK_MONOTONIC) - block_start;
+		cpu += now(CLOCK_PROCESS_CPUTIME_ID) - cpu_block_start;
+
+		if (block_time > deadline)
+			misses++;
+		if (block_time > block_max)
+			block_max = block_time;
+	}
+	const double wall = now(CLOCK_MONOTONIC) - wall_start;
+	const double audio = n_blocks * deadline;
+
+	for (Instance &inst : instances) {
+		inst.processor->setProcessing(false);
+		inst.component->setActive(false);
+		inst.processor->release();
+		inst.component->terminate();
+		inst.component->release();
+	}
+	factory->release();
+	moduleExit();
+	dlclose(module);
+
+	// CPU time only covers process() calls, wall time includes input
+	// generation
+	printf("plugin:              %s\n", info.name);
+	printf("instances:           %d\n", n_instances);
+	printf("block size:          %d samples @ %g Hz (%.3f ms)\n", block_size, sample_rate, 1e3 * deadline);
+	printf("blocks:              %ld (%.1f s of audio)\n", n_blocks, audio);
+	printf("CPU time:            %.3f s (%.1f%% of real time, %.1f ns/sample/instance)\n",
+	       cpu, 100.0 * cpu / audio, 1e9 * cpu / ((double)n_blocks * block_size * n_instances));
+	printf("wall time:           %.3f s\n", wall);
+	printf("worst block:         %.3f ms (%.1f%% of deadline)\n", 1e3 * block_max, 100.0 * block_max / deadline);
+	printf("deadline misses:     %ld (%.3f%%)\n", misses, 100.0 * misses / n_blocks);
+	printf("instances per block: %.0f (at 100%% of one core, from mean CPU time)\n", n_instances * audio / cpu);
+	printf("heap per instance:   %.1f KiB\n", (double)(heap_after - heap_before) / n_instances / 1024.0);
+	printf("RSS per instance:    %.1f KiB\n", (double)(rss_after - rss_before) / n_instances / 1024.0);
+
+	return 0;
+}
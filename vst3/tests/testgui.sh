@@ -0,0 +1,9 @@
+#!/bin/bash
+
+# Editor rendering with one and many instances, at a few sizes, writing PNGs
+# of the first editor to build/guibench-*.png
+
+build/guibench -e 1 -s 1 -f 500
+build/guibench -e 1 -s 2.5 -f 500 -o build/guibench
+build/guibench -e 1 -s 5 -f 200
+build/guibench -e 16 -s 2.5 -f 100
@@ -0,0 +1,14 @@
+#!/bin/bash
+
+# How many instances fit in one 64 sample buffer at 48 kHz, with each input
+# pattern, then a few other block sizes
+
+for p in noise silence automation; do
+	echo "== $p"
+	build/loadtest -n 32 -b 64 -r 48000 -t 10 -p $p build/asid.vst3
+done
+
+for b in 16 32 128 256 512; do
+	echo "== noise, $b samples"
+	build/loadtest -n 32 -b $b -r 48000 -t 10 -p noise build/asid.vst3
+done